@@ -0,0 +1,59 @@
+#ifndef FLAT_MULTI_POLYGON_H
+#define FLAT_MULTI_POLYGON_H
+
+#include "../Point/Point.h"
+#include "../Polygon/PolygonView.h"
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <initializer_list>
+
+// Many polygons in one flat buffer: interleaved coordinates of all vertices
+// plus the first vertex of each polygon, the same layout as a GeometryFile.
+// Adding a polygon appends to both arrays, so a whole set lives in two
+// allocations that clear() keeps for reuse.
+//
+// Element i is a PolygonView, so every PolygonOps algorithm runs on it. Views
+// are invalidated by add() (the buffer may move) and clear(), and one must
+// not be passed back to add() of the same container.
+template <size_t D, typename T>
+class FlatMultiPolygon {
+    static_assert(D == 2, "FlatMultiPolygon is 2D only for this version.");
+
+    std::vector<T> coords;               // x0 y0 x1 y1 ...
+    std::vector<uint64_t> offsets{0};    // polygon i is vertices [offsets[i], offsets[i + 1])
+
+public:
+    FlatMultiPolygon() = default;
+
+    size_t size() const { return offsets.size() - 1; }
+    bool empty() const { return offsets.size() == 1; }
+    size_t vertex_count() const { return coords.size() / 2; }
+    const T* data() const { return coords.data(); }
+
+    PolygonView<2, T> operator[](size_t i) const;
+    // Unchecked access for hot loops; bounds are only asserted in debug builds
+    PolygonView<2, T> get(size_t i) const noexcept {
+        assert(i + 1 < offsets.size());
+        return PolygonView<2, T>(coords.data() + 2 * offsets[i], static_cast<size_t>(offsets[i + 1] - offsets[i]));
+    }
+
+    // Appends anything polygon-like (see PolygonOps.h) and returns its index;
+    // throws std::invalid_argument for fewer than 3 vertices
+    template <typename Poly>
+    size_t add(const Poly& poly);
+    size_t add(std::initializer_list<Point<2, T>> pts);
+
+    void reserve(size_t polygons, size_t vertices);
+    // O(1) for the trivially destructible contents; capacity is kept
+    void clear() noexcept;
+
+    // out[i] = area of polygon i, positive whatever its orientation; throws
+    // std::invalid_argument if `out` is shorter than size()
+    void areas(std::span<T> out) const;
+};
+
+#include "FlatMultiPolygon.ipp"
+
+#endif // FLAT_MULTI_POLYGON_H
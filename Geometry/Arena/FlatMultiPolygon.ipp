@@ -0,0 +1,60 @@
+#ifndef FLAT_MULTI_POLYGON_IPP
+#define FLAT_MULTI_POLYGON_IPP
+
+#include "FlatMultiPolygon.h"
+#include <stdexcept>
+
+template <size_t D, typename T>
+PolygonView<2, T> FlatMultiPolygon<D, T>::operator[](size_t i) const {
+    if (i >= size()) throw std::out_of_range("FlatMultiPolygon index out of range");
+    return get(i);
+}
+
+template <size_t D, typename T>
+template <typename Poly>
+size_t FlatMultiPolygon<D, T>::add(const Poly& poly) {
+    const size_t n = poly.size();
+    if (n < 3) throw std::invalid_argument("Polygon must have at least 3 vertices");
+    const size_t at = coords.size();
+    coords.resize(at + 2 * n);
+    T* xy = coords.data() + at;
+    for (size_t i = 0; i < n; ++i) {
+        const Point<2, T>& p = polygon_vertex(poly, i);
+        xy[2 * i] = p.dx();
+        xy[2 * i + 1] = p.dy();
+    }
+    offsets.push_back(offsets.back() + n);
+    return size() - 1;
+}
+
+template <size_t D, typename T>
+size_t FlatMultiPolygon<D, T>::add(std::initializer_list<Point<2, T>> pts) {
+    if (pts.size() < 3) throw std::invalid_argument("Polygon must have at least 3 vertices");
+    for (const auto& p : pts) {
+        coords.push_back(p.dx());
+        coords.push_back(p.dy());
+    }
+    offsets.push_back(offsets.back() + pts.size());
+    return size() - 1;
+}
+
+template <size_t D, typename T>
+void FlatMultiPolygon<D, T>::reserve(size_t polygons, size_t vertices) {
+    offsets.reserve(polygons + 1);
+    coords.reserve(2 * vertices);
+}
+
+template <size_t D, typename T>
+void FlatMultiPolygon<D, T>::clear() noexcept {
+    coords.clear();
+    offsets.resize(1);
+}
+
+template <size_t D, typename T>
+void FlatMultiPolygon<D, T>::areas(std::span<T> out) const {
+    if (out.size() < size())
+        throw std::invalid_argument("Output buffer smaller than polygon count");
+    for (size_t i = 0; i < size(); ++i) out[i] = polygon_area(get(i));
+}
+
+#endif // FLAT_MULTI_POLYGON_IPP
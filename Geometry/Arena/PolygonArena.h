@@ -0,0 +1,63 @@
+#ifndef POLYGON_ARENA_H
+#define POLYGON_ARENA_H
+
+#include "../Point/Point.h"
+#include "../Polygon/PolygonView.h"
+#include <vector>
+#include <memory>
+#include <initializer_list>
+
+// Bump allocator for polygons that live as long as one request. Coordinates
+// are carved out of large blocks, so adding a polygon is a pointer bump
+// instead of a heap allocation. reset() drops every polygon at once in O(1)
+// and keeps the blocks, so after warming up a request allocates nothing.
+//
+// Polygons come back as PolygonViews, which run every PolygonOps algorithm
+// (area, containment, intersection, ray casts, triangulate). A view is valid
+// until the next reset() or the arena's destruction. An arena is not
+// thread-safe; give each worker thread its own.
+template <size_t D, typename T>
+class PolygonArena {
+    static_assert(D == 2, "PolygonArena is 2D only for this version.");
+
+    struct Block {
+        std::unique_ptr<T[]> data;
+        size_t size;   // coordinates
+    };
+
+    std::vector<Block> blocks;
+    size_t block_vertices;
+    size_t current = 0;    // block being filled
+    size_t used = 0;       // coordinates taken from it
+    size_t polygons = 0;
+    size_t reserved = 0;   // coordinates over all blocks
+
+public:
+    // The first block holds `block_vertices` vertices; later ones double
+    explicit PolygonArena(size_t block_vertices = 4096);
+
+    PolygonArena(PolygonArena&&) noexcept = default;
+    PolygonArena& operator=(PolygonArena&&) noexcept = default;
+    PolygonArena(const PolygonArena&) = delete;
+    PolygonArena& operator=(const PolygonArena&) = delete;
+
+    // Uninitialised room for n vertices as 2n interleaved coordinates
+    T* allocate(size_t n);
+
+    // Copies of anything polygon-like (see PolygonOps.h); throws
+    // std::invalid_argument for fewer than 3 vertices
+    template <typename Poly>
+    PolygonView<2, T> add(const Poly& poly);
+    PolygonView<2, T> add(std::initializer_list<Point<2, T>> pts);
+
+    // Invalidates every view handed out so far
+    void reset() noexcept;
+
+    size_t size() const { return polygons; }
+    size_t block_count() const { return blocks.size(); }
+    size_t capacity() const { return reserved / 2; }   // vertices
+};
+
+#include "PolygonArena.ipp"
+
+#endif // POLYGON_ARENA_H
@@ -0,0 +1,70 @@
+#ifndef POLYGON_ARENA_IPP
+#define POLYGON_ARENA_IPP
+
+#include "PolygonArena.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+template <size_t D, typename T>
+PolygonArena<D, T>::PolygonArena(size_t block_vertices) : block_vertices(std::max<size_t>(block_vertices, 3)) {}
+
+template <size_t D, typename T>
+T* PolygonArena<D, T>::allocate(size_t n) {
+    if (n > std::numeric_limits<size_t>::max() / (2 * sizeof(T)))
+        throw std::length_error("PolygonArena allocation too large");
+    const size_t need = 2 * n;
+    // Blocks kept from before a reset are reused in order; one too small
+    // for this polygon is skipped until the next reset
+    while (current < blocks.size() && blocks[current].size - used < need) {
+        ++current;
+        used = 0;
+    }
+    if (current == blocks.size()) {
+        size_t size = blocks.empty() ? 2 * block_vertices : 2 * blocks.back().size;
+        size = std::max(size, need);
+        blocks.push_back({std::make_unique_for_overwrite<T[]>(size), size});
+        reserved += size;
+        used = 0;
+    }
+    T* p = blocks[current].data.get() + used;
+    used += need;
+    return p;
+}
+
+template <size_t D, typename T>
+template <typename Poly>
+PolygonView<2, T> PolygonArena<D, T>::add(const Poly& poly) {
+    const size_t n = poly.size();
+    if (n < 3) throw std::invalid_argument("Polygon must have at least 3 vertices");
+    T* xy = allocate(n);
+    for (size_t i = 0; i < n; ++i) {
+        const Point<2, T>& p = polygon_vertex(poly, i);
+        xy[2 * i] = p.dx();
+        xy[2 * i + 1] = p.dy();
+    }
+    ++polygons;
+    return PolygonView<2, T>(xy, n);
+}
+
+template <size_t D, typename T>
+PolygonView<2, T> PolygonArena<D, T>::add(std::initializer_list<Point<2, T>> pts) {
+    if (pts.size() < 3) throw std::invalid_argument("Polygon must have at least 3 vertices");
+    T* xy = allocate(pts.size());
+    T* out = xy;
+    for (const auto& p : pts) {
+        *out++ = p.dx();
+        *out++ = p.dy();
+    }
+    ++polygons;
+    return PolygonView<2, T>(xy, pts.size());
+}
+
+template <size_t D, typename T>
+void PolygonArena<D, T>::reset() noexcept {
+    current = 0;
+    used = 0;
+    polygons = 0;
+}
+
+#endif // POLYGON_ARENA_IPP
@@ -0,0 +1,187 @@
+#include "PolygonArena.h"
+#include "FlatMultiPolygon.h"
+#include "../Polygon/Polygon.h"
+#include "../Batch/ThreadPool.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <atomic>
+#include <array>
+#include <span>
+#include <string>
+#include <cstdlib>
+#include <new>
+
+// Every heap allocation in the process goes through here. Kept out of line
+// so GCC does not pair the inlined malloc and free across call sites.
+static std::atomic<size_t> allocations{0};
+
+[[gnu::noinline]] void* operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+using ms = std::chrono::duration<double, std::milli>;
+using Shape = std::array<Point<2, float>, 32>;
+
+// Polygon `k` of request `r`: 3 to 32 vertices around a random centre, the
+// same for every storage path
+static std::span<const Point<2, float>> shape(size_t r, size_t k, Shape& buf) {
+    std::minstd_rand rng(static_cast<uint32_t>(r * 7919 + k + 1));
+    std::uniform_real_distribution<float> pos(-100.0f, 100.0f), radius(0.5f, 2.0f);
+    const size_t n = 3 + rng() % 30;
+    const float cx = pos(rng), cy = pos(rng);
+    for (size_t i = 0; i < n; ++i) {
+        float a = 2 * float(M_PI) * i / n, rad = radius(rng);
+        buf[i] = Point<2, float>{cx + rad * std::cos(a), cy + rad * std::sin(a)};
+    }
+    return {buf.data(), n};
+}
+
+static constexpr size_t per_request = 1000;
+static const Point<2, float> probe{0, 0};
+
+// One request per path: build its polygons, query each, tear down.
+// Returns the summed areas plus the containment count as a checksum.
+static double request_vector(size_t r) {
+    Shape buf;
+    std::vector<Polygon<2, float>> polys;
+    polys.reserve(per_request);
+    for (size_t k = 0; k < per_request; ++k) {
+        auto pts = shape(r, k, buf);
+        polys.emplace_back(std::vector<Point<2, float>>(pts.begin(), pts.end()));
+    }
+    double sum = 0;
+    for (const auto& p : polys) sum += p.area() + p.isInside(probe);
+    return sum;
+}
+
+static double request_arena(size_t r, PolygonArena<2, float>& arena) {
+    Shape buf;
+    arena.reset();
+    std::array<PolygonView<2, float>, per_request> views;
+    for (size_t k = 0; k < per_request; ++k) views[k] = arena.add(shape(r, k, buf));
+    double sum = 0;
+    for (const auto& p : views) sum += p.area() + p.isInside(probe);
+    return sum;
+}
+
+static double request_flat(size_t r, FlatMultiPolygon<2, float>& flat) {
+    Shape buf;
+    flat.clear();
+    for (size_t k = 0; k < per_request; ++k) flat.add(shape(r, k, buf));
+    double sum = 0;
+    for (size_t k = 0; k < flat.size(); ++k) sum += flat.get(k).area() + flat.get(k).isInside(probe);
+    return sum;
+}
+
+int main(int argc, char** argv) {
+    const size_t requests = 200;
+    std::cout << "=== ALLOCATIONS PER REQUEST (" << per_request << " polygons of 3-32 vertices) ===\n";
+    PolygonArena<2, float> arena;
+    FlatMultiPolygon<2, float> flat;
+    request_arena(0, arena);   // warm up: the arena and the buffers grow once
+    request_flat(0, flat);
+
+    double sums[3] = {0, 0, 0};
+    size_t counts[3];
+    double times[3];
+    for (int path = 0; path < 3; ++path) {
+        size_t before = allocations.load();
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t r = 0; r < requests; ++r)
+            sums[path] += path == 0 ? request_vector(r) : path == 1 ? request_arena(r, arena) : request_flat(r, flat);
+        auto t1 = std::chrono::steady_clock::now();
+        counts[path] = allocations.load() - before;
+        times[path] = ms(t1 - t0).count();
+    }
+    const char* names[3] = {"std::vector Polygon", "PolygonArena       ", "FlatMultiPolygon   "};
+    for (int path = 0; path < 3; ++path)
+        std::cout << names[path] << ": " << double(counts[path]) / requests << " allocations, "
+                  << times[path] / requests << " ms per request\n";
+    std::cout << "Arena: " << arena.block_count() << " blocks, " << arena.capacity() << " vertices reserved\n";
+
+    // Throughput with concurrent workers, one arena or buffer per thread
+    const size_t threads = argc > 1 ? std::stoul(argv[1]) : 4;
+    ThreadPool pool(threads);
+    const size_t jobs = 2000;
+    std::cout << "\n=== THROUGHPUT, " << pool.size() << " threads, " << jobs << " requests ===\n";
+    double mt_sums[3];
+    for (int path = 0; path < 3; ++path) {
+        std::vector<double> out(jobs);
+        auto t0 = std::chrono::steady_clock::now();
+        pool.parallel_for(jobs, 4, [&](size_t b, size_t e) {
+            thread_local PolygonArena<2, float> local_arena;
+            thread_local FlatMultiPolygon<2, float> local_flat;
+            for (size_t r = b; r < e; ++r)
+                out[r] = path == 0 ? request_vector(r) : path == 1 ? request_arena(r, local_arena)
+                                                                   : request_flat(r, local_flat);
+        });
+        auto t1 = std::chrono::steady_clock::now();
+        mt_sums[path] = 0;
+        for (double s : out) mt_sums[path] += s;
+        std::cout << names[path] << ": " << jobs * per_request / ms(t1 - t0).count() / 1000 << " M polygons/s\n";
+    }
+
+    std::cout << "\n[TEST] All paths compute the same results: ";
+    bool ok = std::abs(sums[1] - sums[0]) <= 1e-6 * std::abs(sums[0]) && sums[2] == sums[1] &&
+              std::abs(mt_sums[1] - mt_sums[0]) <= 1e-6 * std::abs(mt_sums[0]) && mt_sums[2] == mt_sums[1];
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Warm arena and flat buffer do not allocate: ";
+    std::cout << (counts[1] == 0 && counts[2] == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Arena views hold the vertices they were given: ";
+    arena.reset();
+    Shape buf;
+    auto pts = shape(1, 2, buf);
+    auto view = arena.add(pts);
+    Polygon<2, float> poly(std::vector<Point<2, float>>(pts.begin(), pts.end()));
+    auto tri = arena.add({Point<2, float>{0, 0}, Point<2, float>{4, 0}, Point<2, float>{0, 3}});
+    auto copy = arena.add(poly);
+    ok = view.size() == poly.size() && tri.area() == 6 && arena.size() == 3;
+    for (size_t i = 0; ok && i < poly.size(); ++i) ok = view[i] == poly[i] && copy[i] == poly[i];
+    ok = ok && view.area() == poly.area() && view.intersect(poly);
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Reset reuses blocks, oversized polygons get their own: ";
+    PolygonArena<2, float> small(16);
+    std::vector<Point<2, float>> big;
+    for (int i = 0; i < 1000; ++i) {
+        float a = 2 * float(M_PI) * i / 1000;
+        big.push_back(Point<2, float>{std::cos(a), std::sin(a)});
+    }
+    for (int round = 0; round < 3; ++round) {
+        small.reset();
+        for (int i = 0; i < 10; ++i) small.add(pts);
+        small.add(big);
+    }
+    auto big_view = small.add(big);
+    ok = small.size() == 12 && small.block_count() <= 6 && std::abs(big_view.area() - float(M_PI)) < 1e-3f;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] FlatMultiPolygon indexing, areas and clear: ";
+    FlatMultiPolygon<2, float> multi;
+    multi.add(poly);
+    multi.add({Point<2, float>{0, 0}, Point<2, float>{4, 0}, Point<2, float>{0, 3}});
+    multi.add(view);
+    std::vector<float> areas(multi.size());
+    multi.areas(areas);
+    ok = multi.size() == 3 && multi.vertex_count() == 2 * poly.size() + 3 && areas[0] == poly.area() &&
+         areas[1] == 6 && multi[2][0] == poly[0];
+    multi.clear();
+    ok = ok && multi.empty() && multi.vertex_count() == 0;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Fewer than 3 vertices and bad indices throw: ";
+    int thrown = 0;
+    try { arena.add(std::span<const Point<2, float>>(pts.data(), 2)); } catch (const std::invalid_argument&) { ++thrown; }
+    try { multi.add(std::span<const Point<2, float>>(pts.data(), 2)); } catch (const std::invalid_argument&) { ++thrown; }
+    try { multi[0]; } catch (const std::out_of_range&) { ++thrown; }
+    std::cout << (thrown == 3 ? "PASS" : "FAIL") << "\n";
+    return 0;
+}
@@ -0,0 +1,51 @@
+#ifndef BATCH_QUERY_H
+#define BATCH_QUERY_H
+
+#include "ThreadPool.h"
+#include "../Point/Point.h"
+#include "../Ray/Ray.h"
+#include "../Ray/LineSegment.h"
+#include "../Polygon/Polygon.h"
+#include <span>
+#include <cstddef>
+
+template <typename T>
+struct BatchHit {
+    static constexpr size_t none = static_cast<size_t>(-1);
+    size_t polygon = none;   // index into the polygon set, or none
+    T t = 0;
+
+    explicit operator bool() const { return polygon != none; }
+};
+
+// Runs Ray::intersect, Polygon::isInside and Polygon::intersect for whole
+// spans of queries against a fixed polygon set on a ThreadPool. Results go to
+// caller-provided buffers of the same length as the queries; nothing is
+// allocated per call.
+template <size_t D, typename T>
+class BatchQuery {
+    static_assert(D == 2, "BatchQuery is 2D only for this version.");
+
+    ThreadPool& pool;
+    std::span<const Polygon<2, T>> polygons;
+    size_t chunk;
+
+public:
+    static constexpr size_t none = BatchHit<T>::none;
+
+    BatchQuery(ThreadPool& pool, std::span<const Polygon<2, T>> polygons, size_t chunk = 256);
+
+    void set_chunk(size_t c) { chunk = c ? c : 1; }
+    size_t chunk_size() const { return chunk; }
+
+    // out[i]: closest polygon hit by rays[i] and its t
+    void intersect(std::span<const Ray<2, T>> rays, std::span<BatchHit<T>> out) const;
+    // out[i]: first polygon containing pts[i], or none
+    void contains(std::span<const Point<2, T>> pts, std::span<size_t> out) const;
+    // out[i]: first polygon whose boundary segs[i] crosses, or none
+    void intersect(std::span<const LineSegment<2, T>> segs, std::span<size_t> out) const;
+};
+
+#include "BatchQuery.ipp"
+
+#endif // BATCH_QUERY_H
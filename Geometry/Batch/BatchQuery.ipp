@@ -0,0 +1,50 @@
+#ifndef BATCH_QUERY_IPP
+#define BATCH_QUERY_IPP
+
+#include "BatchQuery.h"
+#include <stdexcept>
+
+template <size_t D, typename T>
+BatchQuery<D, T>::BatchQuery(ThreadPool& pool_, std::span<const Polygon<2, T>> polygons_, size_t chunk_)
+    : pool(pool_), polygons(polygons_), chunk(chunk_ ? chunk_ : 1) {}
+
+template <size_t D, typename T>
+void BatchQuery<D, T>::intersect(std::span<const Ray<2, T>> rays, std::span<BatchHit<T>> out) const {
+    if (out.size() < rays.size()) throw std::invalid_argument("Output buffer smaller than ray batch");
+    pool.parallel_for(rays.size(), chunk, [&](size_t b, size_t e) {
+        for (size_t i = b; i < e; ++i) {
+            BatchHit<T> best;
+            for (size_t p = 0; p < polygons.size(); ++p) {
+                auto t = rays[i].intersect(polygons[p]);
+                if (t && (!best || *t < best.t)) best = {p, *t};
+            }
+            out[i] = best;
+        }
+    });
+}
+
+template <size_t D, typename T>
+void BatchQuery<D, T>::contains(std::span<const Point<2, T>> pts, std::span<size_t> out) const {
+    if (out.size() < pts.size()) throw std::invalid_argument("Output buffer smaller than point batch");
+    pool.parallel_for(pts.size(), chunk, [&](size_t b, size_t e) {
+        for (size_t i = b; i < e; ++i) {
+            out[i] = none;
+            for (size_t p = 0; p < polygons.size(); ++p)
+                if (polygons[p].isInside(pts[i])) { out[i] = p; break; }
+        }
+    });
+}
+
+template <size_t D, typename T>
+void BatchQuery<D, T>::intersect(std::span<const LineSegment<2, T>> segs, std::span<size_t> out) const {
+    if (out.size() < segs.size()) throw std::invalid_argument("Output buffer smaller than segment batch");
+    pool.parallel_for(segs.size(), chunk, [&](size_t b, size_t e) {
+        for (size_t i = b; i < e; ++i) {
+            out[i] = none;
+            for (size_t p = 0; p < polygons.size(); ++p)
+                if (polygons[p].intersect(segs[i])) { out[i] = p; break; }
+        }
+    });
+}
+
+#endif // BATCH_QUERY_IPP
@@ -0,0 +1,61 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+// Fixed set of worker threads running one parallel_for at a time. The index
+// range is split evenly across workers; each drains its own share chunk by
+// chunk and then steals half of whatever a busier worker has left. The calling
+// thread works as worker 0. Jobs are passed without heap allocation.
+class ThreadPool {
+    struct alignas(64) Slot {
+        std::mutex m;
+        size_t next = 0, end = 0;
+    };
+
+    size_t count;
+    std::unique_ptr<Slot[]> slots;
+    std::vector<std::thread> workers;
+
+    std::mutex m;
+    std::condition_variable wake, done;
+    uint64_t generation = 0;
+    size_t active = 0;
+    bool stop = false;
+
+    void (*invoke)(void*, size_t, size_t) = nullptr;
+    void* job = nullptr;
+    size_t chunk = 1;
+    std::exception_ptr error;
+
+    bool take(size_t self, size_t& b, size_t& e);
+    bool steal(size_t victim, size_t self);
+    void work(size_t self);
+    void worker_main(size_t self);
+
+public:
+    // threads == 0 uses std::thread::hardware_concurrency()
+    explicit ThreadPool(size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return count; }
+
+    // Calls body(begin, end) over [0, n) in pieces of at most `chunk_size`
+    // indices and blocks until all are done. The first exception thrown by
+    // body is rethrown here once every worker has stopped.
+    template <typename Body>
+    void parallel_for(size_t n, size_t chunk_size, Body&& body);
+};
+
+#include "ThreadPool.ipp"
+
+#endif // THREAD_POOL_H
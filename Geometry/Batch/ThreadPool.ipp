@@ -0,0 +1,121 @@
+#ifndef THREAD_POOL_IPP
+#define THREAD_POOL_IPP
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <type_traits>
+
+inline ThreadPool::ThreadPool(size_t threads)
+    : count(threads ? threads : std::max(1u, std::thread::hardware_concurrency())),
+      slots(new Slot[count]) {
+    for (size_t i = 1; i < count; ++i)
+        workers.emplace_back(&ThreadPool::worker_main, this, i);
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lk(m);
+        stop = true;
+    }
+    wake.notify_all();
+    for (auto& w : workers) w.join();
+}
+
+inline bool ThreadPool::take(size_t self, size_t& b, size_t& e) {
+    Slot& s = slots[self];
+    std::lock_guard<std::mutex> lk(s.m);
+    if (s.next >= s.end) return false;
+    b = s.next;
+    e = std::min(s.end, s.next + chunk);
+    s.next = e;
+    return true;
+}
+
+inline bool ThreadPool::steal(size_t victim, size_t self) {
+    size_t b, e;
+    {
+        Slot& v = slots[victim];
+        std::lock_guard<std::mutex> lk(v.m);
+        if (v.next >= v.end) return false;
+        size_t left = v.end - v.next;
+        // take the back half, or everything if only one chunk remains
+        b = left <= chunk ? v.next : v.next + left / 2;
+        e = v.end;
+        v.end = b;
+    }
+    Slot& s = slots[self];
+    std::lock_guard<std::mutex> lk(s.m);
+    s.next = b;
+    s.end = e;
+    return true;
+}
+
+inline void ThreadPool::work(size_t self) {
+    for (;;) {
+        size_t b, e;
+        if (take(self, b, e)) {
+            try {
+                invoke(job, b, e);
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(m);
+                if (!error) error = std::current_exception();
+            }
+            continue;
+        }
+        bool stolen = false;
+        for (size_t k = 1; k < count && !stolen; ++k)
+            stolen = steal((self + k) % count, self);
+        if (!stolen) return;
+    }
+}
+
+inline void ThreadPool::worker_main(size_t self) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lk(m);
+            wake.wait(lk, [&] { return stop || generation != seen; });
+            if (stop) return;
+            seen = generation;
+        }
+        work(self);
+        {
+            std::lock_guard<std::mutex> lk(m);
+            if (--active == 0) done.notify_one();
+        }
+    }
+}
+
+template <typename Body>
+void ThreadPool::parallel_for(size_t n, size_t chunk_size, Body&& body) {
+    if (n == 0) return;
+    if (chunk_size == 0) chunk_size = 1;
+    if (count == 1 || n <= chunk_size) {
+        for (size_t b = 0; b < n; b += chunk_size) body(b, std::min(n, b + chunk_size));
+        return;
+    }
+
+    using B = std::remove_reference_t<Body>;
+    {
+        std::lock_guard<std::mutex> lk(m);
+        invoke = [](void* ctx, size_t b, size_t e) { (*static_cast<B*>(ctx))(b, e); };
+        job = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+        chunk = chunk_size;
+        error = nullptr;
+        for (size_t i = 0; i < count; ++i) {
+            slots[i].next = n * i / count;
+            slots[i].end = n * (i + 1) / count;
+        }
+        active = count - 1;
+        ++generation;
+    }
+    wake.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> lk(m);
+    done.wait(lk, [&] { return active == 0; });
+    if (error) std::rethrow_exception(error);
+}
+
+#endif // THREAD_POOL_IPP
@@ -0,0 +1,155 @@
+#include "BatchQuery.h"
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <atomic>
+#include <algorithm>
+#include <string>
+
+static Polygon<2, float> random_polygon(std::mt19937& rng, float cx, float cy) {
+    std::uniform_real_distribution<float> radius(5.0f, 20.0f);
+    // 8-gon around (cx, cy) with jittered radii
+    std::vector<Point<2, float>> pts;
+    for (int k = 0; k < 8; ++k) {
+        float a = k * float(M_PI) / 4, r = radius(rng);
+        pts.push_back(Point<2, float>{cx + r * std::cos(a), cy + r * std::sin(a)});
+    }
+    return Polygon<2, float>(pts);
+}
+
+int main(int argc, char** argv) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> ang(0.0f, 2 * float(M_PI));
+
+    std::vector<Polygon<2, float>> polys;
+    for (int i = 0; i < 200; ++i) polys.push_back(random_polygon(rng, pos(rng), pos(rng)));
+
+    const size_t n = 20000;
+    std::vector<Ray<2, float>> rays;
+    std::vector<Point<2, float>> pts;
+    std::vector<LineSegment<2, float>> segs;
+    for (size_t i = 0; i < n; ++i) {
+        float a = ang(rng);
+        Point<2, float> p{pos(rng), pos(rng)};
+        rays.emplace_back(p, Vector<2, float>{std::cos(a), std::sin(a)});
+        pts.push_back(p);
+        segs.emplace_back(p, Point<2, float>{p[0] + 40 * std::cos(a), p[1] + 40 * std::sin(a)});
+    }
+
+    // An explicit count: the default follows hardware_concurrency and would
+    // take the serial path on a single-core machine
+    ThreadPool pool(4);
+    BatchQuery<2, float> batch(pool, polys, 64);
+
+    std::vector<BatchHit<float>> hits(n);
+    std::vector<size_t> inside(n), crossed(n);
+    batch.intersect(rays, hits);
+    batch.contains(pts, inside);
+    batch.intersect(segs, crossed);
+
+    std::cout << "[TEST] Ray::intersect batch matches serial loop: ";
+    size_t wrong = 0;
+    for (size_t i = 0; i < n; ++i) {
+        BatchHit<float> ref;
+        for (size_t p = 0; p < polys.size(); ++p) {
+            auto t = rays[i].intersect(polys[p]);
+            if (t && (!ref || *t < ref.t)) ref = {p, *t};
+        }
+        if (ref.polygon != hits[i].polygon || ref.t != hits[i].t) ++wrong;
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Polygon::isInside batch matches serial loop: ";
+    wrong = 0;
+    size_t found = 0;
+    for (size_t i = 0; i < n; ++i) {
+        size_t ref = BatchQuery<2, float>::none;
+        for (size_t p = 0; p < polys.size(); ++p)
+            if (polys[p].isInside(pts[i])) { ref = p; break; }
+        wrong += ref != inside[i];
+        found += ref != BatchQuery<2, float>::none;
+    }
+    std::cout << (wrong == 0 && found > 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Polygon::intersect batch matches serial loop: ";
+    wrong = 0;
+    for (size_t i = 0; i < n; ++i) {
+        size_t ref = BatchQuery<2, float>::none;
+        for (size_t p = 0; p < polys.size(); ++p)
+            if (polys[p].intersect(segs[i])) { ref = p; break; }
+        wrong += ref != crossed[i];
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Short output buffer throws: ";
+    try {
+        std::vector<size_t> small(n - 1);
+        batch.contains(pts, small);
+        std::cout << "FAIL\n";
+    } catch (const std::invalid_argument&) {
+        std::cout << "PASS\n";
+    }
+
+    std::cout << "[TEST] Exception in body reaches caller: ";
+    try {
+        pool.parallel_for(n, 16, [](size_t b, size_t e) {
+            if (b <= 12345 && 12345 < e) throw std::runtime_error("boom");
+        });
+        std::cout << "FAIL\n";
+    } catch (const std::runtime_error&) {
+        std::cout << "PASS\n";
+    }
+
+    // The caller sleeps through its own chunks so the other threads get to
+    // run, and only they throw
+    std::cout << "[TEST] Exception on a worker thread reaches caller: ";
+    const auto caller = std::this_thread::get_id();
+    try {
+        pool.parallel_for(64, 1, [&](size_t, size_t) {
+            if (std::this_thread::get_id() == caller)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            else
+                throw std::runtime_error("worker");
+        });
+        std::cout << "FAIL\n";
+    } catch (const std::runtime_error& e) {
+        std::cout << (std::string(e.what()) == "worker" ? "PASS" : "FAIL") << "\n";
+    }
+
+    std::cout << "[TEST] Pool still covers every index after an exception: ";
+    std::vector<std::atomic<int>> visits(n);
+    pool.parallel_for(n, 16, [&](size_t b, size_t e) {
+        for (size_t i = b; i < e; ++i) ++visits[i];
+    });
+    std::cout << (std::all_of(visits.begin(), visits.end(), [](const auto& v) { return v == 1; }) ? "PASS" : "FAIL")
+              << "\n";
+
+    // Scaling: every ray against every polygon, no shared writes. Pass a
+    // thread count on the command line to extend the table (e.g. 32).
+    const size_t m = 4000;
+    std::span<const Ray<2, float>> bench(rays.data(), m);
+    std::cout << "\n=== SCALING (" << m << " rays x " << polys.size() << " polygons) ===\n\n";
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1) max_threads = std::max<size_t>(max_threads, std::strtoul(argv[1], nullptr, 10));
+
+    double base = 0;
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "Krays/s" << std::setw(10) << "speedup" << "\n";
+    for (size_t t = 1; t <= max_threads; t = (t == max_threads || 2 * t <= max_threads) ? 2 * t : max_threads) {
+        ThreadPool p(t);
+        BatchQuery<2, float> q(p, polys, 64);
+        q.intersect(bench, hits);   // warm up
+        auto t0 = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < 3; ++rep) q.intersect(bench, hits);
+        auto t1 = std::chrono::steady_clock::now();
+        double rate = 3.0 * m / std::chrono::duration<double>(t1 - t0).count() / 1e3;
+        if (t == 1) base = rate;
+        std::cout << std::setw(8) << t << std::setw(14) << std::fixed << std::setprecision(1) << rate
+                  << std::setw(9) << std::setprecision(2) << rate / base << "x\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+#ifndef CLIPPER_H
+#define CLIPPER_H
+
+#include "../Point/Point.h"
+#include "../Ray/LineSegment.h"
+#include "../Polygon/Polygon.h"
+#include "../PreparedPolygon/PreparedPolygon.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+
+enum class BooleanOp { Union, Intersection, Difference, Xor };
+
+// Outer ring counter-clockwise, holes clockwise
+template <size_t D, typename T>
+struct PolygonWithHoles {
+    Polygon<D, T> outer;
+    std::vector<Polygon<D, T>> holes;
+};
+
+template <size_t D, typename T>
+using MultiPolygon = std::vector<PolygonWithHoles<D, T>>;
+
+template <size_t D, typename T>
+T area(const MultiPolygon<D, T>& mp);
+
+// Boolean operations between simple polygons. Both boundaries are split at
+// every crossing (found by SegmentSweep, located by LineSegment::intersect),
+// each piece is classified inside or outside the other polygon by its
+// midpoint, the pieces the operation keeps are linked into rings (split
+// where they touch at a vertex), and holes are matched to the outer ring
+// around them; a hole with none, which only inconsistent input can produce,
+// throws std::runtime_error. The clip polygon is prepared once, its edges
+// walked into a grid along their length (see EdgeGrid.h), so many subjects
+// can be clipped against it and each only sweeps the clip edges near its
+// own bounding box.
+template <size_t D, typename T>
+class Clipper {
+    static_assert(D == 2, "Clipper is 2D only for this version.");
+
+    // Its edge grid serves both the inside tests and the search for clip
+    // edges near a subject
+    PreparedPolygon<2, T> clip_inside;
+    bool clip_ccw = true;
+
+    // Clip edge e, counter-clockwise
+    LineSegment<2, T> clip_edge(size_t e) const;
+
+public:
+    // `clip` must be simple; either orientation is accepted
+    explicit Clipper(const Polygon<2, T>& clip);
+
+    MultiPolygon<2, T> clip(const Polygon<2, T>& subject, BooleanOp op) const;
+
+    // Streaming: every subject against the same clip polygon
+    std::vector<MultiPolygon<2, T>> clip(std::span<const Polygon<2, T>> subjects, BooleanOp op) const;
+};
+
+template <size_t D, typename T>
+MultiPolygon<D, T> boolean_op(const Polygon<D, T>& a, const Polygon<D, T>& b, BooleanOp op);
+
+#include "Clipper.ipp"
+
+#endif // CLIPPER_H
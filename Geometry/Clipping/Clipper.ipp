@@ -0,0 +1,285 @@
+#ifndef CLIPPER_IPP
+#define CLIPPER_IPP
+
+#include "Clipper.h"
+#include "../Sweep/SegmentIntersection.h"
+#include "../Predicates/Predicates.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+template <size_t D, typename T>
+T area(const MultiPolygon<D, T>& mp) {
+    T total = 0;
+    for (const auto& p : mp) {
+        total += p.outer.area();
+        for (const auto& h : p.holes) total -= h.area();
+    }
+    return total;
+}
+
+template <size_t D, typename T>
+Clipper<D, T>::Clipper(const Polygon<2, T>& clip) : clip_inside(clip), clip_ccw(clip.orientation() > 0) {
+    if (clip.orientation() == 0) throw std::invalid_argument("Clip polygon has no area");
+    if (clip.size() > std::numeric_limits<uint32_t>::max() / 4)
+        throw std::length_error("Clip polygon too large");
+}
+
+template <size_t D, typename T>
+LineSegment<2, T> Clipper<D, T>::clip_edge(size_t e) const {
+    const auto& g = clip_inside.edges()[e];
+    return clip_ccw ? LineSegment<2, T>(g.a, g.b) : LineSegment<2, T>(g.b, g.a);
+}
+
+template <size_t D, typename T>
+MultiPolygon<2, T> Clipper<D, T>::clip(const Polygon<2, T>& subject, BooleanOp op) const {
+    using P = Point<2, T>;
+    auto key = [](const P& p) { return std::make_pair(p[0], p[1]); };
+
+    MultiPolygon<2, T> result;
+    if (subject.orientation() == 0) {
+        // an empty subject leaves the clip polygon or nothing
+        if (op == BooleanOp::Union || op == BooleanOp::Xor) {
+            std::vector<P> ring;
+            for (size_t e = 0; e < clip_inside.edges().size(); ++e) {
+                auto g = clip_edge(e);
+                if (g.a != g.b) ring.push_back(g.a);
+            }
+            result.push_back({Polygon<2, T>(std::move(ring)), {}});
+        }
+        return result;
+    }
+
+    // Subject edges counter-clockwise, then the clip edges near the subject
+    std::vector<LineSegment<2, T>> segs;
+    const size_t n = subject.size();
+    const bool ccw = subject.orientation() > 0;
+    for (size_t i = 0; i < n; ++i) {
+        const P& a = subject[i];
+        const P& b = subject[(i + 1) % n];
+        if (a == b) continue;
+        if (ccw) segs.emplace_back(a, b);
+        else segs.emplace_back(b, a);
+    }
+    const size_t na = segs.size();
+    auto box = subject.bounding_box();
+    std::vector<uint32_t> near;
+    clip_inside.edges().near(box.first[0], box.first[1], box.second[0], box.second[1], near);
+    // zero-length clip edges take no part
+    near.erase(std::remove_if(near.begin(), near.end(), [&](uint32_t e) {
+        const auto& g = clip_inside.edges()[e];
+        return g.a == g.b;
+    }), near.end());
+    for (uint32_t e : near) segs.push_back(clip_edge(e));
+
+    // Split points per segment from every subject/clip pair that meets
+    std::vector<std::vector<P>> splits(segs.size());
+    auto on_interior = [](const LineSegment<2, T>& s, const P& p) {
+        return p != s.a && p != s.b && Vector<2, T>::dot_product(p - s.a, s.b - s.a) > 0 &&
+               Vector<2, T>::dot_product(p - s.b, s.a - s.b) > 0;
+    };
+    SegmentSweep<2, T> sweep(segs);
+    sweep.run([&](size_t i, size_t j, const P&) {
+        if ((i < na) == (j < na)) return false;
+        const auto& e = segs[i];
+        const auto& f = segs[j];
+        if (e.collinear(f)) {
+            // overlapping runs are cut at each other's endpoints
+            for (const P& p : {f.a, f.b}) if (on_interior(e, p)) splits[i].push_back(p);
+            for (const P& p : {e.a, e.b}) if (on_interior(f, p)) splits[j].push_back(p);
+            return false;
+        }
+        double o1 = orient2d(f.a, f.b, e.a), o2 = orient2d(f.a, f.b, e.b);
+        double o3 = orient2d(e.a, e.b, f.a), o4 = orient2d(e.a, e.b, f.b);
+        if ((o1 > 0 && o2 > 0) || (o1 < 0 && o2 < 0) || (o3 > 0 && o4 > 0) || (o3 < 0 && o4 < 0))
+            return false;
+        // touching at an endpoint uses that vertex exactly so both sides agree
+        P p = o1 == 0 ? e.a : o2 == 0 ? e.b : o3 == 0 ? f.a : o4 == 0 ? f.b : *e.intersect(f);
+        splits[i].push_back(p);
+        splits[j].push_back(p);
+        return false;
+    });
+
+    // Pieces between consecutive split points
+    struct Piece { P a, b; bool subject; };
+    std::vector<Piece> pieces;
+    for (size_t k = 0; k < segs.size(); ++k) {
+        const auto& s = segs[k];
+        auto& cut = splits[k];
+        Vector<2, T> dir = s.b - s.a;
+        std::sort(cut.begin(), cut.end(), [&](const P& p, const P& q) {
+            return Vector<2, T>::dot_product(p - s.a, dir) < Vector<2, T>::dot_product(q - s.a, dir);
+        });
+        P from = s.a;
+        for (const P& p : cut) {
+            if (p == from || p == s.b) continue;
+            pieces.push_back({from, p, k < na});
+            from = p;
+        }
+        pieces.push_back({from, s.b, k < na});
+    }
+
+    // Classify each piece against the other polygon; coincident edges are
+    // decided once, on the subject's copy
+    enum Side : uint8_t { Unset, Outside, Inside, Same, Opposite, Drop };
+    std::vector<uint8_t> side(pieces.size(), Unset);
+    std::map<std::pair<std::pair<T, T>, std::pair<T, T>>, size_t> subject_pieces;
+    for (size_t k = 0; k < pieces.size(); ++k)
+        if (pieces[k].subject) subject_pieces[{key(pieces[k].a), key(pieces[k].b)}] = k;
+    for (size_t k = 0; k < pieces.size(); ++k) {
+        if (pieces[k].subject) continue;
+        auto same = subject_pieces.find({key(pieces[k].a), key(pieces[k].b)});
+        auto opp = subject_pieces.find({key(pieces[k].b), key(pieces[k].a)});
+        if (same != subject_pieces.end()) side[same->second] = Same;
+        if (opp != subject_pieces.end()) side[opp->second] = Opposite;
+        if (same != subject_pieces.end() || opp != subject_pieces.end()) side[k] = Drop;
+    }
+
+    PreparedPolygon<2, T> subject_inside(subject);
+    for (size_t k = 0; k < pieces.size(); ++k) {
+        if (side[k] != Unset) continue;
+        const Piece& pc = pieces[k];
+        P mid{(pc.a[0] + pc.b[0]) / 2, (pc.a[1] + pc.b[1]) / 2};
+        side[k] = (pc.subject ? clip_inside.contains(mid) : subject_inside.contains(mid)) ? Inside : Outside;
+    }
+    // Keep the directed pieces the operation needs
+    std::vector<std::pair<P, P>> kept;
+    auto keep = [&](const Piece& pc, uint8_t s) {
+        switch (op) {
+        case BooleanOp::Intersection:
+            if (s == Inside || (pc.subject && s == Same)) kept.push_back({pc.a, pc.b});
+            break;
+        case BooleanOp::Union:
+            if (s == Outside || (pc.subject && s == Same)) kept.push_back({pc.a, pc.b});
+            break;
+        case BooleanOp::Difference:
+            if (pc.subject && (s == Outside || s == Opposite)) kept.push_back({pc.a, pc.b});
+            if (!pc.subject && s == Inside) kept.push_back({pc.b, pc.a});
+            break;
+        case BooleanOp::Xor:
+            if (s == Outside) kept.push_back({pc.a, pc.b});
+            if (s == Inside) kept.push_back({pc.b, pc.a});
+            break;
+        }
+    };
+    for (size_t k = 0; k < pieces.size(); ++k) keep(pieces[k], side[k]);
+    // clip edges never near the subject stay outside it, which only union
+    // and xor keep; `near` is sorted, so one merge pass skips the rest
+    if (op == BooleanOp::Union || op == BooleanOp::Xor) {
+        auto skip = near.begin();
+        for (uint32_t e = 0; e < clip_inside.edges().size(); ++e) {
+            if (skip != near.end() && *skip == e) { ++skip; continue; }
+            auto g = clip_edge(e);
+            if (g.a != g.b) kept.push_back({g.a, g.b});
+        }
+    }
+
+    // Link into rings, taking the sharpest right turn where rings touch. When
+    // a walk comes back to a vertex it already passed, the loop since then is
+    // split off as a ring of its own, so rings may share vertices but never
+    // pass through one twice.
+    struct Ring { std::vector<P> pts; P probe; };
+    std::map<std::pair<T, T>, std::vector<size_t>> outgoing;
+    for (size_t k = 0; k < kept.size(); ++k) outgoing[key(kept[k].first)].push_back(k);
+    std::vector<uint8_t> used(kept.size(), 0);
+    std::vector<Ring> rings;
+    auto emit = [&](std::vector<size_t>::const_iterator b, std::vector<size_t>::const_iterator e) {
+        // probe at the midpoint of an uncleaned piece: no other ring's
+        // vertex lies inside a piece, so it is off every other boundary
+        const auto& first = kept[*b];
+        Ring ring{{}, P{(first.first[0] + first.second[0]) / 2, (first.first[1] + first.second[1]) / 2}};
+        // drop vertices left on a straight run by the splitting
+        std::vector<P>& clean = ring.pts;
+        for (auto it = b; it != e; ++it) {
+            const P& p = kept[*it].first;
+            while (clean.size() >= 2 && orient2d(clean[clean.size() - 2], clean.back(), p) == 0) clean.pop_back();
+            clean.push_back(p);
+        }
+        while (clean.size() >= 3 && orient2d(clean[clean.size() - 2], clean.back(), clean[0]) == 0) clean.pop_back();
+        size_t skip = 0;
+        while (clean.size() - skip >= 3 && orient2d(clean.back(), clean[skip], clean[skip + 1]) == 0) ++skip;
+        clean.erase(clean.begin(), clean.begin() + skip);
+        if (clean.size() >= 3) rings.push_back(std::move(ring));
+    };
+    std::vector<size_t> path;
+    std::map<std::pair<T, T>, size_t> on_path;   // vertex -> position in path
+    for (size_t start = 0; start < kept.size(); ++start) {
+        if (used[start]) continue;
+        path.assign(1, start);
+        on_path.clear();
+        on_path[key(kept[start].first)] = 0;
+        used[start] = 1;
+        while (!path.empty()) {
+            const auto& last = kept[path.back()];
+            const P& at = last.second;
+            auto seen = on_path.find(key(at));
+            if (seen != on_path.end()) {
+                const size_t from = seen->second;
+                emit(path.begin() + from, path.end());
+                for (size_t k = from; k < path.size(); ++k) on_path.erase(key(kept[path[k]].first));
+                path.resize(from);
+                continue;
+            }
+            Vector<2, T> in = at - last.first;
+            size_t next = kept.size();
+            double best = std::numeric_limits<double>::infinity();
+            for (size_t c : outgoing[key(at)]) {
+                if (used[c]) continue;
+                Vector<2, T> out = kept[c].second - kept[c].first;
+                double turn = std::atan2(double(in[0]) * out[1] - double(in[1]) * out[0],
+                                         double(in[0]) * out[0] + double(in[1]) * out[1]);
+                if (turn < best) { best = turn; next = c; }
+            }
+            if (next == kept.size()) break;   // open chain from inconsistent input
+            used[next] = 1;
+            on_path[key(at)] = path.size();
+            path.push_back(next);
+        }
+    }
+
+    // Counter-clockwise rings are outers, clockwise ones are holes
+    std::vector<Polygon<2, T>> holes;
+    std::vector<P> probes;
+    for (auto& r : rings) {
+        Polygon<2, T> poly(std::move(r.pts));
+        int o = poly.orientation();
+        if (o > 0) result.push_back({std::move(poly), {}});
+        else if (o < 0) { holes.push_back(std::move(poly)); probes.push_back(r.probe); }
+    }
+    std::vector<std::optional<PreparedPolygon<2, T>>> prepared(holes.empty() ? 0 : result.size());
+    for (size_t k = 0; k < holes.size(); ++k) {
+        // smallest outer around the probe
+        const P& probe = probes[k];
+        size_t best = result.size();
+        for (size_t r = 0; r < result.size(); ++r) {
+            auto ob = result[r].outer.bounding_box();
+            if (probe[0] < ob.first[0] || probe[0] > ob.second[0] ||
+                probe[1] < ob.first[1] || probe[1] > ob.second[1]) continue;
+            if (!prepared[r]) prepared[r].emplace(result[r].outer);
+            if (!prepared[r]->contains(probe)) continue;
+            if (best == result.size() || result[r].outer.area() < result[best].outer.area()) best = r;
+        }
+        if (best == result.size()) throw std::runtime_error("Hole with no enclosing outer ring");
+        result[best].holes.push_back(std::move(holes[k]));
+    }
+    return result;
+}
+
+template <size_t D, typename T>
+std::vector<MultiPolygon<2, T>> Clipper<D, T>::clip(std::span<const Polygon<2, T>> subjects, BooleanOp op) const {
+    std::vector<MultiPolygon<2, T>> out;
+    out.reserve(subjects.size());
+    for (const auto& s : subjects) out.push_back(clip(s, op));
+    return out;
+}
+
+template <size_t D, typename T>
+MultiPolygon<D, T> boolean_op(const Polygon<D, T>& a, const Polygon<D, T>& b, BooleanOp op) {
+    return Clipper<D, T>(b).clip(a, op);
+}
+
+#endif // CLIPPER_IPP
@@ -0,0 +1,158 @@
+#include "Clipper.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+
+using P = Point<2, double>;
+
+static Polygon<2, double> square(double x, double y, double s) {
+    return Polygon<2, double>({P{x, y}, P{x + s, y}, P{x + s, y + s}, P{x, y + s}});
+}
+
+// Star-shaped n-gon with wobbly radius around (cx, cy)
+static Polygon<2, double> blob(std::mt19937& rng, size_t n, double cx, double cy, double r) {
+    std::uniform_real_distribution<double> wob(0.7, 1.0);
+    std::vector<P> pts;
+    for (size_t i = 0; i < n; ++i) {
+        double a = 2 * M_PI * i / n, rr = r * wob(rng);
+        pts.push_back(P{cx + rr * std::cos(a), cy + rr * std::sin(a)});
+    }
+    return Polygon<2, double>(pts);
+}
+
+// Star-shaped n-gon snapped to the integer grid, with an axis-aligned corner
+// between consecutive vertices when `ortho` is set. May come out non-simple.
+static Polygon<2, double> grid_star(std::mt19937& rng, int span, bool ortho) {
+    const size_t n = 3 + rng() % (span <= 3 ? 6 : 14);
+    std::vector<P> pts;
+    for (size_t i = 0; i < n; ++i) {
+        double a = 2 * M_PI * i / n, r = span * (0.2 + 0.8 * (rng() % 1000) / 1000.0);
+        P p{std::round(r * std::cos(a)), std::round(r * std::sin(a))};
+        if (ortho && !pts.empty()) pts.push_back(P{p[0], pts.back()[1]});
+        pts.push_back(p);
+    }
+    return Polygon<2, double>(pts);
+}
+
+// u + i = a + b, d = a - i and x = u - i
+static bool identities_hold(const Polygon<2, double>& a, const Polygon<2, double>& b) {
+    double u = area(boolean_op(a, b, BooleanOp::Union));
+    double in = area(boolean_op(a, b, BooleanOp::Intersection));
+    double d = area(boolean_op(a, b, BooleanOp::Difference));
+    double x = area(boolean_op(a, b, BooleanOp::Xor));
+    double sa = a.area(), sb = b.area(), tol = 1e-9 * (sa + sb);
+    return std::abs(u + in - sa - sb) < tol && std::abs(d - (sa - in)) < tol && std::abs(x - (u - in)) < tol;
+}
+
+static const char* names[] = {"union", "intersection", "difference", "xor"};
+
+int main() {
+    auto a = square(0, 0, 2), b = square(1, 1, 2);
+    for (int op = 0; op < 4; ++op) {
+        auto r = boolean_op(a, b, BooleanOp(op));
+        std::cout << names[op] << ": " << r.size() << " polygon(s), area " << area(r) << "\n";
+        for (const auto& p : r) std::cout << "  " << p.outer << "\n";
+    }
+
+    std::cout << "\n[TEST] Overlapping squares: ";
+    bool ok = std::abs(area(boolean_op(a, b, BooleanOp::Union)) - 7) < 1e-12 &&
+              std::abs(area(boolean_op(a, b, BooleanOp::Intersection)) - 1) < 1e-12 &&
+              std::abs(area(boolean_op(a, b, BooleanOp::Difference)) - 3) < 1e-12 &&
+              std::abs(area(boolean_op(a, b, BooleanOp::Xor)) - 6) < 1e-12;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Difference with a contained polygon leaves a hole: ";
+    auto holed = boolean_op(square(0, 0, 4), square(1, 1, 1), BooleanOp::Difference);
+    ok = holed.size() == 1 && holed[0].holes.size() == 1 && holed[0].holes[0].orientation() < 0 &&
+         std::abs(area(holed) - 15) < 1e-12;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Union across a shared edge merges into one rectangle: ";
+    auto merged = boolean_op(square(0, 0, 1), square(1, 0, 1), BooleanOp::Union);
+    ok = merged.size() == 1 && merged[0].outer.size() == 4 && merged[0].holes.empty() &&
+         std::abs(area(merged) - 2) < 1e-12 &&
+         boolean_op(square(0, 0, 1), square(1, 0, 1), BooleanOp::Intersection).empty();
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Identical polygons: ";
+    ok = std::abs(area(boolean_op(a, a, BooleanOp::Intersection)) - 4) < 1e-12 &&
+         std::abs(area(boolean_op(a, a, BooleanOp::Union)) - 4) < 1e-12 &&
+         boolean_op(a, a, BooleanOp::Difference).empty() && boolean_op(a, a, BooleanOp::Xor).empty();
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Disjoint polygons: ";
+    auto far = square(10, 10, 1);
+    ok = boolean_op(a, far, BooleanOp::Union).size() == 2 &&
+         boolean_op(a, far, BooleanOp::Intersection).empty() &&
+         std::abs(area(boolean_op(a, far, BooleanOp::Difference)) - 4) < 1e-12;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    // Rings of the result touching at a vertex, and a crossing on a
+    // vertical edge
+    std::cout << "[TEST] Reported integer cases: ";
+    Polygon<2, double> ta({P{1, 0}, P{1, 2}, P{0, 2}, P{-1, 1}, P{-2, 0}, P{-1, -1}, P{0, -2}, P{1, -1}});
+    Polygon<2, double> tb({P{1, 0}, P{2, 1}, P{0, 1}, P{-1, 2}, P{-2, 1}, P{-2, -1}, P{0, -1}, P{1, -2}, P{2, -1}});
+    Polygon<2, double> tc({P{927, 250}, P{-492, 250}, P{-300, -896}});
+    Polygon<2, double> td({P{564, 176}, P{131, 595}, P{-381, 413}, P{-605, -81}, P{-78, -208}, P{63, -103}});
+    Polygon<2, double> te({P{810, -1}, P{-468, 808}, P{-373, -645}});
+    Polygon<2, double> tf({P{601, -2}, P{466, 205}, P{186, 203}, P{186, 563}, P{-78, 762}, P{-131, 228},
+                           P{-740, 537}, P{-441, 92}, P{-479, -104}, P{-700, -512}, P{-473, -825},
+                           P{-54, -535}, P{213, -650}, P{243, -270}, P{356, -160}});
+    ok = identities_hold(ta, tb) && std::abs(area(boolean_op(ta, tb, BooleanOp::Xor)) - 5.5) < 1e-12 &&
+         identities_hold(tc, td) && !boolean_op(tc, td, BooleanOp::Intersection).empty() &&
+         identities_hold(te, tf);
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Area identities on integer grids: ";
+    std::mt19937 grid_rng(17);
+    size_t pairs = 0, failed = 0;
+    for (int trial = 0; trial < 3000; ++trial) {
+        const int span = trial % 4 == 0 ? 2 : trial % 4 == 1 ? 5 : trial % 4 == 2 ? 10 : 1000;
+        auto ga = grid_star(grid_rng, span, trial % 3 == 0), gb = grid_star(grid_rng, span, trial % 3 == 0);
+        if (ga.orientation() == 0 || gb.orientation() == 0 || !ga.is_simple() || !gb.is_simple()) continue;
+        ++pairs;
+        failed += !identities_hold(ga, gb);
+    }
+    std::cout << (failed == 0 ? "PASS" : "FAIL") << " (" << failed << " of " << pairs << " pairs)\n";
+
+    std::cout << "[TEST] Area identities on large blobs: ";
+    std::mt19937 rng(9);
+    auto big_a = blob(rng, 20000, 0, 0, 100), big_b = blob(rng, 20000, 40, 10, 100);
+    auto t0 = std::chrono::steady_clock::now();
+    double u = area(boolean_op(big_a, big_b, BooleanOp::Union));
+    auto t1 = std::chrono::steady_clock::now();
+    double in = area(boolean_op(big_a, big_b, BooleanOp::Intersection));
+    double d = area(boolean_op(big_a, big_b, BooleanOp::Difference));
+    double x = area(boolean_op(big_a, big_b, BooleanOp::Xor));
+    double sa = big_a.area(), sb = big_b.area(), tol = 1e-9 * (sa + sb);
+    ok = std::abs(u - (sa + sb - in)) < tol && std::abs(d - (sa - in)) < tol && std::abs(x - (u - in)) < tol;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+    std::cout << "  union of two 20000-gons: "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms\n";
+
+    std::cout << "\n=== STREAMING ===\n\n";
+    auto region = blob(rng, 5000, 0, 0, 300);
+    std::vector<Polygon<2, double>> tiles;
+    std::uniform_real_distribution<double> pos(-320, 320);
+    for (int i = 0; i < 2000; ++i) tiles.push_back(blob(rng, 32, pos(rng), pos(rng), 8));
+
+    t0 = std::chrono::steady_clock::now();
+    Clipper<2, double> clipper(region);
+    auto streamed = clipper.clip(tiles, BooleanOp::Intersection);
+    t1 = std::chrono::steady_clock::now();
+    std::vector<MultiPolygon<2, double>> one_shot;
+    for (const auto& t : tiles) one_shot.push_back(boolean_op(t, region, BooleanOp::Intersection));
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << tiles.size() << " tiles against a 5000-gon: prepared once "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, rebuilt per tile "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+
+    std::cout << "[TEST] Streaming matches one-shot clipping: ";
+    size_t wrong = 0;
+    for (size_t i = 0; i < tiles.size(); ++i)
+        wrong += std::abs(area(streamed[i]) - area(one_shot[i])) > 1e-9 * tiles[i].area();
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#ifndef CONVEX_POLYGON_H
+#define CONVEX_POLYGON_H
+
+#include "../Point/Point.h"
+#include "../Vector/Vector_new.h"
+#include "../Polygon/Polygon.h"
+#include <vector>
+#include <span>
+#include <optional>
+#include <cstdint>
+
+template <typename T>
+struct Contact {
+    T depth;              // how far the shapes must separate along `normal`
+    Vector<2, T> normal;  // unit axis of least penetration, pointing from the first shape to the second
+};
+
+// Strictly convex polygon, stored counter-clockwise with collinear vertices
+// removed. Containment is a binary search over the fan from vertex 0 and
+// overlap is a separating-axis test over the edge normals of both shapes.
+template <size_t D, typename T>
+class ConvexPolygon {
+    static_assert(D == 2, "ConvexPolygon is 2D only for this version.");
+
+    Polygon<2, T> poly;
+    Point<2, T> lo, hi;
+
+    // outward normal of edge i
+    Vector<2, T> outward(size_t i) const { return poly.normal(i) * T(-1); }
+    // largest separation of `other` from this shape along one of our normals
+    T max_separation(const ConvexPolygon& other, size_t& edge) const;
+    // true if one of our normals is a separating axis
+    bool separates(const ConvexPolygon& other) const;
+    bool boxes_overlap(const ConvexPolygon& other) const;
+
+public:
+    ConvexPolygon() = default;
+    // throws std::invalid_argument unless `p` is convex and simple
+    explicit ConvexPolygon(const Polygon<2, T>& p);
+
+    size_t size() const { return poly.size(); }
+    const Point<2, T>& operator[](size_t i) const { return poly[i]; }
+    const Polygon<2, T>& polygon() const { return poly; }
+    const Point<2, T>& min_corner() const { return lo; }
+    const Point<2, T>& max_corner() const { return hi; }
+
+    // boundary points count as inside
+    bool contains(const Point<2, T>& p) const;
+
+    bool overlaps(const ConvexPolygon& other) const;
+    std::optional<Contact<T>> collide(const ConvexPolygon& other) const;
+
+    // One against many: bit i of `mask` (LSB first within each word) is set
+    // when others[i] overlaps; `mask` needs ceil(others.size() / 64) words.
+    // Returns the number of overlaps.
+    size_t overlaps(std::span<const ConvexPolygon> others, std::span<uint64_t> mask) const;
+    // out[i] is the contact with others[i], or empty if they are apart
+    void collide(std::span<const ConvexPolygon> others, std::span<std::optional<Contact<T>>> out) const;
+};
+
+#include "ConvexPolygon.ipp"
+
+#endif // CONVEX_POLYGON_H
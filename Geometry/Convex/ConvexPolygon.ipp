@@ -0,0 +1,136 @@
+#ifndef CONVEX_POLYGON_IPP
+#define CONVEX_POLYGON_IPP
+
+#include "ConvexPolygon.h"
+#include "../Predicates/Predicates.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+template <size_t D, typename T>
+ConvexPolygon<D, T>::ConvexPolygon(const Polygon<2, T>& p) {
+    if (p.size() < 3) throw std::invalid_argument("Polygon must have at least 3 vertices");
+    if (!p.is_convex() || p.orientation() == 0 || !p.is_simple())
+        throw std::invalid_argument("Polygon is not convex");
+
+    std::vector<Point<2, T>> pts;
+    pts.reserve(p.size());
+    for (size_t i = 0; i < p.size(); ++i) pts.push_back(p[i]);
+    if (p.orientation() < 0) std::reverse(pts.begin(), pts.end());
+
+    // drop repeated and collinear vertices so every fan triangle has area
+    std::vector<Point<2, T>> ring;
+    ring.reserve(pts.size());
+    for (const auto& v : pts) {
+        if (!ring.empty() && ring.back() == v) continue;
+        while (ring.size() >= 2 && orient2d(ring[ring.size() - 2], ring.back(), v) == 0) ring.pop_back();
+        ring.push_back(v);
+    }
+    while (ring.size() >= 3 && (ring.back() == ring[0] ||
+                                orient2d(ring[ring.size() - 2], ring.back(), ring[0]) == 0))
+        ring.pop_back();
+    while (ring.size() >= 3 && orient2d(ring.back(), ring[0], ring[1]) == 0) ring.erase(ring.begin());
+    if (ring.size() < 3) throw std::invalid_argument("Polygon is not convex");
+
+    lo = hi = ring[0];
+    for (const auto& v : ring) {
+        lo[0] = std::min(lo[0], v[0]); hi[0] = std::max(hi[0], v[0]);
+        lo[1] = std::min(lo[1], v[1]); hi[1] = std::max(hi[1], v[1]);
+    }
+    poly = Polygon<2, T>(std::move(ring));
+}
+
+template <size_t D, typename T>
+bool ConvexPolygon<D, T>::contains(const Point<2, T>& p) const {
+    if (p[0] < lo[0] || p[0] > hi[0] || p[1] < lo[1] || p[1] > hi[1]) return false;
+    const size_t n = poly.size();
+    const auto& v0 = poly[0];
+    if (orient2d(v0, poly[1], p) < 0 || orient2d(v0, poly[n - 1], p) > 0) return false;
+
+    // last fan edge v0-v[k] with p on its left
+    size_t l = 1, r = n - 1;
+    while (r - l > 1) {
+        size_t m = (l + r) / 2;
+        if (orient2d(v0, poly[m], p) >= 0) l = m;
+        else r = m;
+    }
+    return orient2d(poly[l], poly[l + 1], p) >= 0;
+}
+
+template <size_t D, typename T>
+bool ConvexPolygon<D, T>::boxes_overlap(const ConvexPolygon& other) const {
+    return lo[0] <= other.hi[0] && other.lo[0] <= hi[0] &&
+           lo[1] <= other.hi[1] && other.lo[1] <= hi[1];
+}
+
+template <size_t D, typename T>
+T ConvexPolygon<D, T>::max_separation(const ConvexPolygon& other, size_t& edge) const {
+    T best = std::numeric_limits<T>::lowest();
+    for (size_t i = 0; i < poly.size(); ++i) {
+        Vector<2, T> n = outward(i);
+        T s = std::numeric_limits<T>::max();
+        for (size_t j = 0; j < other.size(); ++j)
+            s = std::min(s, Vector<2, T>::dot_product(n, other[j] - poly[i]));
+        if (s > best) {
+            best = s;
+            edge = i;
+        }
+    }
+    return best;
+}
+
+template <size_t D, typename T>
+bool ConvexPolygon<D, T>::separates(const ConvexPolygon& other) const {
+    for (size_t i = 0; i < poly.size(); ++i) {
+        Vector<2, T> n = outward(i);
+        bool apart = true;
+        for (size_t j = 0; j < other.size() && apart; ++j)
+            apart = Vector<2, T>::dot_product(n, other[j] - poly[i]) > 0;
+        if (apart) return true;
+    }
+    return false;
+}
+
+template <size_t D, typename T>
+bool ConvexPolygon<D, T>::overlaps(const ConvexPolygon& other) const {
+    return boxes_overlap(other) && !separates(other) && !other.separates(*this);
+}
+
+template <size_t D, typename T>
+std::optional<Contact<T>> ConvexPolygon<D, T>::collide(const ConvexPolygon& other) const {
+    if (!boxes_overlap(other)) return std::nullopt;
+    size_t ea = 0, eb = 0;
+    T sa = max_separation(other, ea);
+    if (sa > 0) return std::nullopt;
+    T sb = other.max_separation(*this, eb);
+    if (sb > 0) return std::nullopt;
+
+    // the axis of least penetration, turned to point from this shape to other
+    if (sa >= sb) return Contact<T>{-sa, outward(ea)};
+    return Contact<T>{-sb, other.outward(eb) * T(-1)};
+}
+
+template <size_t D, typename T>
+size_t ConvexPolygon<D, T>::overlaps(std::span<const ConvexPolygon> others, std::span<uint64_t> mask) const {
+    if (mask.size() * 64 < others.size())
+        throw std::invalid_argument("Bitmask too small for polygon batch");
+    std::fill(mask.begin(), mask.end(), 0);
+    size_t count = 0;
+    for (size_t i = 0; i < others.size(); ++i) {
+        if (overlaps(others[i])) {
+            mask[i / 64] |= uint64_t(1) << (i % 64);
+            ++count;
+        }
+    }
+    return count;
+}
+
+template <size_t D, typename T>
+void ConvexPolygon<D, T>::collide(std::span<const ConvexPolygon> others,
+                                  std::span<std::optional<Contact<T>>> out) const {
+    if (out.size() < others.size())
+        throw std::invalid_argument("Output buffer smaller than polygon batch");
+    for (size_t i = 0; i < others.size(); ++i) out[i] = collide(others[i]);
+}
+
+#endif // CONVEX_POLYGON_IPP
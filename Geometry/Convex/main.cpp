@@ -0,0 +1,119 @@
+#include "ConvexPolygon.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+
+// Convex k-gon on an ellipse around (cx, cy); angles are jittered but kept
+// far enough apart that float rounding cannot make a reflex turn
+static Polygon<2, float> random_convex(std::mt19937& rng, size_t k, float cx, float cy, float r) {
+    std::uniform_real_distribution<float> jitter(0.0f, 0.5f), squash(0.5f, 1.0f);
+    float sx = r * squash(rng), sy = r * squash(rng), phase = jitter(rng);
+    std::vector<Point<2, float>> pts;
+    for (size_t i = 0; i < k; ++i) {
+        float t = 2 * float(M_PI) * (i + phase + jitter(rng)) / k;
+        pts.push_back(Point<2, float>{cx + sx * std::cos(t), cy + sy * std::sin(t)});
+    }
+    return Polygon<2, float>(pts);
+}
+
+int main() {
+    Polygon<2, float> box({
+        Point<2, float>{0, 0}, Point<2, float>{2, 0}, Point<2, float>{2, 2}, Point<2, float>{0, 2}
+    });
+    Polygon<2, float> tri({
+        Point<2, float>{1.5f, 1}, Point<2, float>{4, 0}, Point<2, float>{4, 2}
+    });
+    ConvexPolygon<2, float> a(box), b(tri);
+
+    if (auto c = a.collide(b))
+        std::cout << "Box vs triangle: depth " << c->depth << ", normal " << c->normal << "\n";
+    std::cout << "Contains (1,1): " << (a.contains(Point<2, float>{1, 1}) ? "YES" : "NO")
+              << ", (3,1): " << (a.contains(Point<2, float>{3, 1}) ? "YES" : "NO") << "\n";
+
+    std::cout << "\n[TEST] Clockwise and collinear input is normalised: ";
+    Polygon<2, float> cw({
+        Point<2, float>{0, 0}, Point<2, float>{0, 2}, Point<2, float>{2, 2},
+        Point<2, float>{2, 1}, Point<2, float>{2, 0}, Point<2, float>{1, 0}
+    });
+    ConvexPolygon<2, float> norm(cw);
+    std::cout << (norm.size() == 4 && norm.polygon().orientation() == 1 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Concave polygon is rejected: ";
+    try {
+        ConvexPolygon<2, float> bad(Polygon<2, float>({
+            Point<2, float>{0, 0}, Point<2, float>{2, 0}, Point<2, float>{1, 1}, Point<2, float>{2, 2},
+            Point<2, float>{0, 2}
+        }));
+        std::cout << "FAIL\n";
+    } catch (const std::invalid_argument&) {
+        std::cout << "PASS\n";
+    }
+
+    std::cout << "[TEST] Contact normal and depth: ";
+    auto c = a.collide(b);
+    bool ok = c && std::abs(c->depth - 0.5f) < 1e-5f &&
+              std::abs(c->normal[0] - 1) < 1e-5f && std::abs(c->normal[1]) < 1e-5f;
+    auto rc = b.collide(a);
+    ok = ok && rc && std::abs(rc->depth - 0.5f) < 1e-5f && std::abs(rc->normal[0] + 1) < 1e-5f;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> pos(-100.0f, 100.0f);
+
+    std::cout << "[TEST] contains() matches isInside on a 1000-gon: ";
+    Polygon<2, float> disc = random_convex(rng, 1000, 0, 0, 80);
+    ConvexPolygon<2, float> cdisc(disc);
+    std::vector<Point<2, float>> pts;
+    for (int i = 0; i < 200000; ++i) pts.push_back(Point<2, float>{pos(rng), pos(rng)});
+    size_t wrong = 0;
+    for (const auto& p : pts) wrong += cdisc.contains(p) != disc.isInside(p);
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::vector<Polygon<2, float>> shapes;
+    std::vector<ConvexPolygon<2, float>> convex;
+    for (int i = 0; i < 5000; ++i) {
+        shapes.push_back(random_convex(rng, 16, pos(rng), pos(rng), 6));
+        convex.emplace_back(shapes.back());
+    }
+    ConvexPolygon<2, float> probe(random_convex(rng, 16, 0, 0, 30));
+
+    std::cout << "[TEST] SAT overlap matches Polygon::intersect: ";
+    std::vector<uint64_t> mask((convex.size() + 63) / 64);
+    probe.overlaps(convex, mask);
+    wrong = 0;
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        bool sat = (mask[i / 64] >> (i % 64)) & 1;
+        wrong += sat != probe.polygon().intersect(shapes[i]);
+        wrong += sat != bool(probe.collide(convex[i]));
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "\n=== CONVEX vs GENERIC ===\n\n";
+    using ms = std::chrono::duration<double, std::milli>;
+    size_t sink = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& p : pts) sink += disc.isInside(p);
+    auto t1 = std::chrono::steady_clock::now();
+    for (const auto& p : pts) sink += cdisc.contains(p);
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "Containment, " << pts.size() << " points in a 1000-gon: isInside "
+              << ms(t1 - t0).count() << " ms, contains " << ms(t2 - t1).count() << " ms\n";
+
+    const int reps = 20;
+    t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r)
+        for (const auto& s : shapes) sink += probe.polygon().intersect(s);
+    t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) sink += probe.overlaps(convex, mask);
+    t2 = std::chrono::steady_clock::now();
+    std::vector<std::optional<Contact<float>>> contacts(convex.size());
+    for (int r = 0; r < reps; ++r) probe.collide(convex, contacts);
+    auto t3 = std::chrono::steady_clock::now();
+    std::cout << "One vs " << convex.size() << " 16-gons (x" << reps << "): Polygon::intersect "
+              << ms(t1 - t0).count() << " ms, overlaps " << ms(t2 - t1).count()
+              << " ms, collide " << ms(t3 - t2).count() << " ms" << (sink == 7 ? " " : "") << "\n";
+
+    return 0;
+}
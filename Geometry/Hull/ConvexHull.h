@@ -0,0 +1,52 @@
+#ifndef CONVEX_HULL_H
+#define CONVEX_HULL_H
+
+#include "../Point/Point.h"
+#include "../Polygon/Polygon.h"
+#include "../Predicates/Predicates.h"
+#include "../Batch/ThreadPool.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+
+// Convex hull of a point set, kept as indices into the input so nothing is
+// copied. All orientation tests are exact.
+//
+// 2D: Andrew's monotone chain. Points strictly inside the octagon of the
+// extreme points in eight directions are dropped first (Akl-Toussaint). With
+// a pool, the survivors are split into blocks whose hulls are built in
+// parallel, the blocks' hull vertices are merged in sorted order, and one
+// last chain runs over them. indices() is the hull counter-clockwise from
+// the lowest (x, y) point, without collinear vertices.
+//
+// 3D: QuickHull. indices() holds three indices per triangle, each
+// counter-clockwise seen from outside. Coplanar faces stay triangulated.
+//
+// Extra memory is one index per input point plus the hull itself.
+template <size_t D, typename T>
+class ConvexHull {
+    static_assert(D == 2 || D == 3, "ConvexHull supports only 2D or 3D.");
+
+    std::vector<uint32_t> idx;
+
+    void build_2d(std::span<const Point<D, T>> pts, ThreadPool* pool);
+    void build_3d(std::span<const Point<D, T>> pts);
+
+public:
+    // Throws std::invalid_argument for more than 2^32 - 1 points, and in 3D
+    // for fewer than 4 points or when all points are coplanar
+    explicit ConvexHull(std::span<const Point<D, T>> pts);
+    ConvexHull(std::span<const Point<D, T>> pts, ThreadPool& pool);
+
+    const std::vector<uint32_t>& indices() const { return idx; }
+    // Hull vertices in 2D, triangles in 3D
+    size_t size() const { return D == 2 ? idx.size() : idx.size() / 3; }
+
+    // The 2D hull as a Polygon; throws std::invalid_argument if it has
+    // fewer than three vertices
+    Polygon<2, T> polygon(std::span<const Point<D, T>> pts) const;
+};
+
+#include "ConvexHull.ipp"
+
+#endif // CONVEX_HULL_H
@@ -0,0 +1,373 @@
+#ifndef CONVEX_HULL_IPP
+#define CONVEX_HULL_IPP
+
+#include "ConvexHull.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+template <typename T>
+bool hull_less(const Point<2, T>& a, const Point<2, T>& b) {
+    return a.dx() < b.dx() || (a.dx() == b.dx() && a.dy() < b.dy());
+}
+
+// Lower (upper = false) or upper hull of `sorted`, left to right
+template <typename T>
+void hull_chain(std::span<const Point<2, T>> pts, std::span<const uint32_t> sorted, bool upper,
+                std::vector<uint32_t>& out) {
+    out.clear();
+    for (uint32_t i : sorted) {
+        while (out.size() >= 2) {
+            double o = orient2d(pts[out[out.size() - 2]], pts[out.back()], pts[i]);
+            if (upper ? o < 0 : o > 0) break;
+            out.pop_back();
+        }
+        out.push_back(i);
+    }
+}
+
+template <size_t D, typename T>
+ConvexHull<D, T>::ConvexHull(std::span<const Point<D, T>> pts) {
+    if (pts.size() > std::numeric_limits<uint32_t>::max())
+        throw std::invalid_argument("ConvexHull supports at most 2^32 - 1 points");
+    if constexpr (D == 2) build_2d(pts, nullptr);
+    else build_3d(pts);
+}
+
+template <size_t D, typename T>
+ConvexHull<D, T>::ConvexHull(std::span<const Point<D, T>> pts, ThreadPool& pool) {
+    if (pts.size() > std::numeric_limits<uint32_t>::max())
+        throw std::invalid_argument("ConvexHull supports at most 2^32 - 1 points");
+    if constexpr (D == 2) build_2d(pts, &pool);
+    else build_3d(pts);
+}
+
+template <size_t D, typename T>
+void ConvexHull<D, T>::build_2d(std::span<const Point<D, T>> pts, ThreadPool* pool) {
+    const size_t n = pts.size();
+    if (n == 0) return;
+    const size_t min_block = 1 << 14;
+    const size_t blocks = pool ? std::max<size_t>(1, std::min(pool->size() * 4, n / min_block)) : 1;
+    auto run = [&](auto&& body) {
+        if (pool) pool->parallel_for(blocks, 1, body);
+        else body(0, blocks);
+    };
+    auto block_begin = [&](size_t b) { return b * n / blocks; };
+
+    // Extreme points along x, y, x + y and x - y, low and high
+    std::vector<std::array<uint32_t, 8>> extremes(blocks);
+    run([&](size_t lo, size_t hi) {
+        for (size_t b = lo; b < hi; ++b) {
+            std::array<uint32_t, 8> e;
+            std::array<double, 8> best;
+            e.fill(static_cast<uint32_t>(block_begin(b)));
+            best.fill(std::numeric_limits<double>::lowest());
+            for (size_t i = block_begin(b); i < block_begin(b + 1); ++i) {
+                const double x = pts[i].dx(), y = pts[i].dy();
+                const double key[8] = {-x, -x - y, -y, x - y, x, x + y, y, y - x};
+                for (size_t k = 0; k < 8; ++k)
+                    if (key[k] > best[k]) {
+                        best[k] = key[k];
+                        e[k] = static_cast<uint32_t>(i);
+                    }
+            }
+            extremes[b] = e;
+        }
+    });
+    std::array<uint32_t, 8> octagon = extremes[0];
+    for (size_t b = 1; b < blocks; ++b)
+        for (size_t k = 0; k < 8; ++k) {
+            const Point<2, T>& p = pts[extremes[b][k]];
+            const Point<2, T>& q = pts[octagon[k]];
+            const double dir[8][2] = {{-1, 0}, {-1, -1}, {0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}};
+            if (dir[k][0] * p.dx() + dir[k][1] * p.dy() > dir[k][0] * q.dx() + dir[k][1] * q.dy())
+                octagon[k] = extremes[b][k];
+        }
+    // the octagon runs counter-clockwise; a point strictly left of all its
+    // edges is enclosed by hull points and cannot be a hull vertex
+    std::vector<uint32_t> ring;
+    for (uint32_t v : octagon)
+        if (ring.empty() || pts[v] != pts[ring.back()]) ring.push_back(v);
+    while (ring.size() > 1 && pts[ring.back()] == pts[ring.front()]) ring.pop_back();
+    // Each edge as a line n.p + c, evaluated in double with a bound on its
+    // rounding error; only points too close to call go to orient2d
+    struct Line { double nx, ny, c, mag; };
+    std::vector<Line> lines;
+    for (size_t k = 0; ring.size() >= 3 && k < ring.size(); ++k) {
+        const Point<2, T>& a = pts[ring[k]];
+        const Point<2, T>& b = pts[ring[(k + 1) % ring.size()]];
+        double nx = double(a.dy()) - b.dy(), ny = double(b.dx()) - a.dx();
+        lines.push_back({nx, ny, -(nx * a.dx() + ny * a.dy()), std::abs(nx * a.dx()) + std::abs(ny * a.dy())});
+    }
+    auto enclosed = [&](const Point<2, T>& p) {
+        for (size_t k = 0; k < lines.size(); ++k) {
+            const Line& l = lines[k];
+            double v = l.nx * p.dx() + l.ny * p.dy() + l.c;
+            double err = 8 * std::numeric_limits<double>::epsilon() *
+                         (std::abs(l.nx * p.dx()) + std::abs(l.ny * p.dy()) + l.mag);
+            if (v > err) continue;
+            if (v < -err || orient2d(pts[ring[k]], pts[ring[(k + 1) % ring.size()]], p) <= 0) return false;
+        }
+        return !lines.empty();
+    };
+
+    // Each block keeps its survivors, sorted, then only its own hull vertices
+    idx.resize(n);
+    std::vector<size_t> kept(blocks);
+    auto less = [&](uint32_t a, uint32_t b) { return hull_less(pts[a], pts[b]); };
+    run([&](size_t lo, size_t hi) {
+        std::vector<uint32_t> lower, upper;
+        for (size_t b = lo; b < hi; ++b) {
+            uint32_t* out = idx.data() + block_begin(b);
+            size_t k = 0;
+            for (size_t i = block_begin(b); i < block_begin(b + 1); ++i)
+                if (!enclosed(pts[i])) out[k++] = static_cast<uint32_t>(i);
+            std::sort(out, out + k, less);
+            if (blocks > 1) {
+                std::span<const uint32_t> sorted(out, k);
+                hull_chain(pts, sorted, false, lower);
+                hull_chain(pts, sorted, true, upper);
+                k = std::set_union(lower.begin(), lower.end(), upper.begin(), upper.end(), out, less) - out;
+            }
+            kept[b] = k;
+        }
+    });
+
+    // Gather the blocks at the front and merge them pairwise
+    std::vector<size_t> bounds{0};
+    for (size_t b = 0; b < blocks; ++b) {
+        std::copy(idx.begin() + block_begin(b), idx.begin() + block_begin(b) + kept[b], idx.begin() + bounds.back());
+        bounds.push_back(bounds.back() + kept[b]);
+    }
+    while (bounds.size() > 2) {
+        const size_t pairs = (bounds.size() - 1) / 2;
+        auto merge = [&](size_t lo, size_t hi) {
+            for (size_t p = lo; p < hi; ++p)
+                std::inplace_merge(idx.begin() + bounds[2 * p], idx.begin() + bounds[2 * p + 1],
+                                   idx.begin() + bounds[2 * p + 2], less);
+        };
+        if (pool && pairs > 1) pool->parallel_for(pairs, 1, merge);
+        else merge(0, pairs);
+        std::vector<size_t> next;
+        for (size_t i = 0; i < bounds.size(); i += 2) next.push_back(bounds[i]);
+        if (next.back() != bounds.back()) next.push_back(bounds.back());
+        bounds.swap(next);
+    }
+
+    std::span<const uint32_t> sorted(idx.data(), bounds.back());
+    std::vector<uint32_t> lower, upper;
+    hull_chain(pts, sorted, false, lower);
+    hull_chain(pts, sorted, true, upper);
+    idx.clear();
+    idx.shrink_to_fit();
+    if (pts[lower.front()] == pts[lower.back()]) {
+        idx.push_back(lower.front());   // every point is the same
+        return;
+    }
+    idx = std::move(lower);
+    for (size_t k = upper.size() - 1; k-- > 1;) idx.push_back(upper[k]);
+}
+
+template <size_t D, typename T>
+void ConvexHull<D, T>::build_3d(std::span<const Point<D, T>> pts) {
+    const size_t n = pts.size();
+    if (n < 4) throw std::invalid_argument("A 3D hull needs at least 4 points");
+    auto orient = [&](uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+        return orient3d(pts[a], pts[b], pts[c], pts[d]);
+    };
+
+    // Initial tetrahedron: the two x extremes, the point farthest from their
+    // line, and the point farthest from the plane of those three
+    uint32_t i0 = 0, i1 = 0, i2 = 0, i3 = 0;
+    for (uint32_t i = 1; i < n; ++i) {
+        if (pts[i].dx() < pts[i0].dx()) i0 = i;
+        if (pts[i].dx() > pts[i1].dx()) i1 = i;
+    }
+    if (pts[i0] == pts[i1]) {
+        for (uint32_t i = 0; i < n; ++i)
+            if (pts[i] != pts[i0]) i1 = i;
+    }
+    double best = 0;
+    Vector<3, double> axis{double(pts[i1].dx()) - pts[i0].dx(), double(pts[i1].dy()) - pts[i0].dy(),
+                           double(pts[i1].get(2)) - pts[i0].get(2)};
+    for (uint32_t i = 0; i < n; ++i) {
+        Vector<3, double> w{double(pts[i].dx()) - pts[i0].dx(), double(pts[i].dy()) - pts[i0].dy(),
+                            double(pts[i].get(2)) - pts[i0].get(2)};
+        double d = Vector<3, double>::cross_product(axis, w).squared_magnitude();
+        if (d > best) { best = d; i2 = i; }
+    }
+    best = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        double d = std::abs(orient(i0, i1, i2, i));
+        if (d > best) { best = d; i3 = i; }
+    }
+    if (best == 0) throw std::invalid_argument("Points are coplanar; their 3D hull is flat");
+
+    struct Face {
+        uint32_t v[3];
+        uint32_t adj[3];              // face across edge (v[k], v[k+1])
+        double n[3], nabs[3];         // (v1 - v0) x (v2 - v0), and the same with |products| summed
+        double offset, offset_mag;    // n . v0 and nabs . |v0|
+        std::vector<uint32_t> outside;
+        uint32_t eye = 0;             // farthest outside point
+        double eye_dist = 0;
+        bool alive = true;
+    };
+    std::vector<Face> faces;
+    std::vector<uint32_t> free_faces;
+    auto coord = [&](uint32_t i, size_t k) { return double(pts[i].get(k)); };
+    auto new_face = [&](uint32_t a, uint32_t b, uint32_t c) {
+        uint32_t f;
+        if (free_faces.empty()) {
+            f = static_cast<uint32_t>(faces.size());
+            faces.emplace_back();
+        } else {
+            f = free_faces.back();
+            free_faces.pop_back();
+            faces[f] = Face{};
+        }
+        Face& F = faces[f];
+        F.v[0] = a; F.v[1] = b; F.v[2] = c;
+        double u[3], w[3];
+        for (size_t k = 0; k < 3; ++k) {
+            u[k] = coord(b, k) - coord(a, k);
+            w[k] = coord(c, k) - coord(a, k);
+        }
+        F.offset = F.offset_mag = 0;
+        for (size_t k = 0; k < 3; ++k) {
+            size_t j = (k + 1) % 3, l = (k + 2) % 3;
+            F.n[k] = u[j] * w[l] - u[l] * w[j];
+            F.nabs[k] = std::abs(u[j] * w[l]) + std::abs(u[l] * w[j]);
+            F.offset += F.n[k] * coord(a, k);
+            F.offset_mag += F.nabs[k] * std::abs(coord(a, k));
+        }
+        return f;
+    };
+    // Height of p above face f's plane, scaled by the face's doubled area;
+    // 0 unless p is strictly above. The plane is evaluated in double with a
+    // bound on its rounding error and orient3d settles what the bound can't.
+    auto height = [&](uint32_t f, uint32_t p) {
+        const Face& F = faces[f];
+        double h = -F.offset, mag = F.offset_mag;
+        for (size_t k = 0; k < 3; ++k) {
+            h += F.n[k] * coord(p, k);
+            mag += F.nabs[k] * std::abs(coord(p, k));
+        }
+        double err = 32 * std::numeric_limits<double>::epsilon() * mag;
+        if (h > err) return h;
+        if (h < -err) return 0.0;
+        return orient(F.v[0], F.v[1], F.v[2], p) < 0 ? std::max(h, std::numeric_limits<double>::min()) : 0.0;
+    };
+    // p goes to the first face it lies strictly above, if any
+    auto assign = [&](uint32_t p, std::span<const uint32_t> candidates) {
+        for (uint32_t f : candidates) {
+            double d = height(f, p);
+            if (d > 0) {
+                Face& F = faces[f];
+                F.outside.push_back(p);
+                if (d > F.eye_dist) { F.eye_dist = d; F.eye = p; }
+                return;
+            }
+        }
+    };
+
+    const uint32_t tet[4] = {i0, i1, i2, i3};
+    for (size_t k = 0; k < 4; ++k) {
+        uint32_t a = tet[k], b = tet[(k + 1) % 4], c = tet[(k + 2) % 4], d = tet[(k + 3) % 4];
+        if (orient(a, b, c, d) < 0) std::swap(b, c);   // the fourth vertex must lie below
+        new_face(a, b, c);
+    }
+    for (uint32_t f = 0; f < 4; ++f)
+        for (size_t e = 0; e < 3; ++e) {
+            uint32_t u = faces[f].v[e], w = faces[f].v[(e + 1) % 3];
+            for (uint32_t g = 0; g < 4; ++g)
+                for (size_t k = 0; k < 3; ++k)
+                    if (faces[g].v[k] == w && faces[g].v[(k + 1) % 3] == u) faces[f].adj[e] = g;
+        }
+    const uint32_t first[4] = {0, 1, 2, 3};
+    for (uint32_t i = 0; i < n; ++i)
+        if (i != i0 && i != i1 && i != i2 && i != i3) assign(i, first);
+
+    std::vector<uint32_t> pending{0, 1, 2, 3}, visible, created, stack;
+    std::vector<uint32_t> seen;          // last round that looked at each face
+    std::vector<uint8_t> is_visible;
+    std::unordered_map<uint32_t, uint32_t> starting_at;
+    uint32_t round = 0;
+    while (!pending.empty()) {
+        uint32_t f0 = pending.back();
+        pending.pop_back();
+        if (!faces[f0].alive || faces[f0].outside.empty()) continue;
+        const uint32_t eye = faces[f0].eye;
+        ++round;
+        seen.resize(faces.size(), 0);
+        is_visible.resize(faces.size(), 0);
+
+        // Faces the eye sees form a disk; its boundary is the horizon
+        struct HorizonEdge { uint32_t u, w, across; };
+        std::vector<HorizonEdge> horizon;
+        visible.clear();
+        stack.assign(1, f0);
+        seen[f0] = round;
+        is_visible[f0] = 1;
+        while (!stack.empty()) {
+            uint32_t f = stack.back();
+            stack.pop_back();
+            visible.push_back(f);
+            for (size_t e = 0; e < 3; ++e) {
+                uint32_t g = faces[f].adj[e];
+                if (seen[g] != round) {
+                    seen[g] = round;
+                    is_visible[g] = height(g, eye) > 0;
+                    if (is_visible[g]) stack.push_back(g);
+                }
+                if (!is_visible[g]) horizon.push_back({faces[f].v[e], faces[f].v[(e + 1) % 3], g});
+            }
+        }
+
+        // A fan of new faces from the horizon to the eye
+        created.clear();
+        starting_at.clear();
+        for (const auto& h : horizon) {
+            uint32_t nf = new_face(h.u, h.w, eye);
+            faces[nf].adj[0] = h.across;
+            Face& A = faces[h.across];
+            for (size_t k = 0; k < 3; ++k)
+                if (A.v[k] == h.w && A.v[(k + 1) % 3] == h.u) A.adj[k] = nf;
+            starting_at[h.u] = nf;
+            created.push_back(nf);
+        }
+        for (uint32_t nf : created) {
+            uint32_t next = starting_at.at(faces[nf].v[1]);
+            faces[nf].adj[1] = next;
+            faces[next].adj[2] = nf;
+        }
+
+        for (uint32_t f : visible) {
+            std::vector<uint32_t> orphans;
+            orphans.swap(faces[f].outside);
+            faces[f].alive = false;
+            for (uint32_t p : orphans)
+                if (p != eye) assign(p, created);
+        }
+        for (uint32_t f : visible) free_faces.push_back(f);
+        for (uint32_t nf : created)
+            if (!faces[nf].outside.empty()) pending.push_back(nf);
+    }
+
+    for (const Face& F : faces)
+        if (F.alive) idx.insert(idx.end(), F.v, F.v + 3);
+}
+
+template <size_t D, typename T>
+Polygon<2, T> ConvexHull<D, T>::polygon(std::span<const Point<D, T>> pts) const {
+    static_assert(D == 2, "polygon() is only defined for 2D hulls");
+    std::vector<Point<2, T>> ring;
+    ring.reserve(idx.size());
+    for (uint32_t i : idx) ring.push_back(pts[i]);
+    return Polygon<2, T>(std::move(ring));
+}
+
+#endif // CONVEX_HULL_IPP
@@ -0,0 +1,160 @@
+#include "ConvexHull.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <string>
+
+using ms = std::chrono::duration<double, std::milli>;
+
+static std::vector<Point<2, float>> square_cloud(std::mt19937& rng, size_t n) {
+    std::uniform_real_distribution<float> u(-1000.0f, 1000.0f);
+    std::vector<Point<2, float>> pts(n);
+    for (auto& p : pts) p = Point<2, float>{u(rng), u(rng)};
+    return pts;
+}
+
+// Near-worst case: every point close to the hull
+static std::vector<Point<2, float>> circle_cloud(std::mt19937& rng, size_t n) {
+    std::uniform_real_distribution<float> a(0.0f, 2 * float(M_PI));
+    std::vector<Point<2, float>> pts(n);
+    for (auto& p : pts) {
+        float t = a(rng);
+        p = Point<2, float>{1000 * std::cos(t), 1000 * std::sin(t)};
+    }
+    return pts;
+}
+
+static std::vector<Point<3, float>> ball_cloud(std::mt19937& rng, size_t n) {
+    std::normal_distribution<float> g;
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+    std::vector<Point<3, float>> pts(n);
+    for (auto& p : pts) {
+        float x = g(rng), y = g(rng), z = g(rng);
+        float r = 100 * std::cbrt(u(rng)) / std::sqrt(x * x + y * y + z * z + 1e-30f);
+        p = Point<3, float>{x * r, y * r, z * r};
+    }
+    return pts;
+}
+
+// Convex, counter-clockwise, and no point outside
+static bool valid_2d(const std::vector<Point<2, float>>& pts, const std::vector<uint32_t>& hull) {
+    const size_t h = hull.size();
+    if (h < 3) return false;
+    for (size_t k = 0; k < h; ++k)
+        if (orient2d(pts[hull[k]], pts[hull[(k + 1) % h]], pts[hull[(k + 2) % h]]) <= 0) return false;
+    for (const auto& p : pts)
+        for (size_t k = 0; k < h; ++k)
+            if (orient2d(pts[hull[k]], pts[hull[(k + 1) % h]], p) < 0) return false;
+    return true;
+}
+
+// Closed, consistently oriented, Euler characteristic 2, no point outside
+static bool valid_3d(const std::vector<Point<3, float>>& pts, const std::vector<uint32_t>& tri) {
+    std::map<std::pair<uint32_t, uint32_t>, int> edges;
+    std::map<uint32_t, int> verts;
+    for (size_t t = 0; t < tri.size(); t += 3)
+        for (size_t k = 0; k < 3; ++k) {
+            ++edges[{tri[t + k], tri[t + (k + 1) % 3]}];
+            ++verts[tri[t + k]];
+        }
+    for (const auto& [e, count] : edges)
+        if (count != 1 || edges.count({e.second, e.first}) != 1) return false;
+    long euler = long(verts.size()) - long(edges.size() / 2) + long(tri.size() / 3);
+    if (euler != 2) return false;
+    for (const auto& p : pts)
+        for (size_t t = 0; t < tri.size(); t += 3)
+            if (orient3d(pts[tri[t]], pts[tri[t + 1]], pts[tri[t + 2]], p) < 0) return false;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::mt19937 rng(11);
+    ThreadPool pool(argc > 1 ? std::stoul(argv[1]) : 0);
+    const size_t max_n = argc > 2 ? std::stoul(argv[2]) : 10000000;
+
+    std::cout << "=== CONVEX HULL, " << pool.size() << " threads ===\n";
+    bool same = true;
+    for (size_t n = 10000; n <= max_n; n *= 10) {
+        for (int shape = 0; shape < 2; ++shape) {
+            auto pts = shape == 0 ? square_cloud(rng, n) : circle_cloud(rng, n);
+            auto t0 = std::chrono::steady_clock::now();
+            ConvexHull<2, float> serial(pts);
+            auto t1 = std::chrono::steady_clock::now();
+            ConvexHull<2, float> parallel(pts, pool);
+            auto t2 = std::chrono::steady_clock::now();
+            same = same && serial.size() == parallel.size();
+            for (size_t k = 0; same && k < serial.size(); ++k)
+                same = pts[serial.indices()[k]] == pts[parallel.indices()[k]];
+            std::cout << "2D " << (shape == 0 ? "square" : "circle") << " n=" << n << ": hull "
+                      << serial.size() << ", serial " << ms(t1 - t0).count() << " ms, pool "
+                      << ms(t2 - t1).count() << " ms\n";
+        }
+        auto pts = ball_cloud(rng, n);
+        auto t0 = std::chrono::steady_clock::now();
+        ConvexHull<3, float> hull(pts);
+        auto t1 = std::chrono::steady_clock::now();
+        std::cout << "3D ball n=" << n << ": " << hull.size() << " triangles, " << ms(t1 - t0).count() << " ms\n";
+    }
+
+    std::cout << "\n[TEST] Serial and parallel 2D hulls have the same vertices: " << (same ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] 2D hulls are convex and enclose every point: ";
+    bool ok = true;
+    for (size_t n : {3, 10, 1000, 20000}) {
+        auto square = square_cloud(rng, n), circle = circle_cloud(rng, n);
+        ok = ok && valid_2d(square, ConvexHull<2, float>(square, pool).indices()) &&
+             valid_2d(circle, ConvexHull<2, float>(circle, pool).indices());
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Duplicates, collinear points and a single point: ";
+    std::vector<Point<2, float>> grid;
+    for (int i = 0; i < 100; ++i) grid.push_back(Point<2, float>{float(i % 10), float(i / 10)});
+    grid.insert(grid.end(), grid.begin(), grid.end());
+    std::vector<Point<2, float>> line{Point<2, float>{0, 0}, Point<2, float>{2, 2}, Point<2, float>{1, 1},
+                                      Point<2, float>{3, 3}};
+    std::vector<Point<2, float>> single(5, Point<2, float>{7, 7});
+    ConvexHull<2, float> grid_hull(grid), line_hull(line);
+    ok = grid_hull.size() == 4 && grid_hull.polygon(grid).area() == 81 && valid_2d(grid, grid_hull.indices()) &&
+         line_hull.indices() == std::vector<uint32_t>{0, 3} &&
+         ConvexHull<2, float>(single).size() == 1 && ConvexHull<2, float>(std::vector<Point<2, float>>{}).size() == 0;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] 3D hulls are closed, outward and enclose every point: ";
+    ok = true;
+    for (size_t n : {4, 50, 5000}) {
+        auto pts = ball_cloud(rng, n);
+        ok = ok && valid_3d(pts, ConvexHull<3, float>(pts).indices());
+    }
+    std::vector<Point<3, float>> cube;
+    for (int i = 0; i < 1000; ++i) cube.push_back(Point<3, float>{float(i % 10), float(i / 10 % 10), float(i / 100)});
+    ConvexHull<3, float> cube_hull(cube);
+    ok = ok && valid_3d(cube, cube_hull.indices());
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Coplanar points are rejected in 3D: ";
+    try {
+        std::vector<Point<3, float>> flat;
+        for (int i = 0; i < 10; ++i) flat.push_back(Point<3, float>{float(i), float(i * i % 7), 1});
+        ConvexHull<3, float> bad(flat);
+        std::cout << "FAIL\n";
+    } catch (const std::invalid_argument&) {
+        std::cout << "PASS\n";
+    }
+
+    std::cout << "[TEST] Fewer than 4 points are rejected in 3D: ";
+    std::vector<Point<3, float>> few;
+    ok = true;
+    for (int k = 0; k < 4; ++k) {
+        try {
+            ConvexHull<3, float> bad(few);
+            ok = false;
+        } catch (const std::invalid_argument&) {
+        }
+        few.push_back(Point<3, float>{float(k), float(k * k), float(1 - k)});
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+    return 0;
+}
@@ -0,0 +1,109 @@
+#ifndef GEOMETRY_FILE_H
+#define GEOMETRY_FILE_H
+
+#include "../Point/Point.h"
+#include "../Polygon/Polygon.h"
+#include "../Polygon/PolygonView.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// On-disk layout, little-endian, all sections 64-byte aligned:
+//
+//   GeometryFileHeader                      64 bytes
+//   coordinates   vertex_count * 2 * T      x0 y0 x1 y1 ...
+//   offsets       (polygon_count + 1) * u64 first vertex of each polygon
+//
+// Readers must reject a version they do not know and skip any header bytes
+// past the fields they understand (header_size), so fields can be appended.
+struct GeometryFileHeader {
+    char magic[8];            // "CGEOPOLY"
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t byte_order;      // byte_order_mark as stored by the writer
+    uint32_t coord_type;      // 1 = float, 2 = double
+    uint32_t dimension;
+    uint32_t reserved;
+    uint64_t polygon_count;
+    uint64_t vertex_count;
+    uint64_t coords_pos;      // file offsets of the two arrays
+    uint64_t offsets_pos;
+
+    static constexpr char magic_bytes[8] = {'C', 'G', 'E', 'O', 'P', 'O', 'L', 'Y'};
+    static constexpr uint32_t current_version = 1;
+    static constexpr uint32_t byte_order_mark = 0x01020304;
+};
+static_assert(sizeof(GeometryFileHeader) == 64, "GeometryFileHeader layout changed");
+
+template <typename T>
+constexpr uint32_t geometry_coord_type() {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "Geometry files store float or double coordinates");
+    return std::is_same_v<T, float> ? 1 : 2;
+}
+
+// Streams polygons to a file; only the offsets are held in memory until
+// close(), which writes them and the final header.
+template <size_t D, typename T>
+class GeometryWriter {
+    static_assert(D == 2, "GeometryWriter is 2D only for this version.");
+
+    std::ofstream out;
+    std::vector<uint64_t> offsets{0};
+    std::vector<T> buffer;
+
+    void pad_to(uint64_t alignment);
+
+public:
+    explicit GeometryWriter(const std::string& path);
+    ~GeometryWriter();
+
+    GeometryWriter(const GeometryWriter&) = delete;
+    GeometryWriter& operator=(const GeometryWriter&) = delete;
+
+    // Anything with size() and operator[] yielding Point<2, T>
+    template <typename Poly>
+    void add(const Poly& poly);
+
+    size_t size() const { return offsets.size() - 1; }
+    void close();
+};
+
+// Read-only memory map of a geometry file. Opening only checks the header;
+// a polygon's coordinates are paged in by the OS when its view is first read.
+template <size_t D, typename T>
+class GeometryFile {
+    static_assert(D == 2, "GeometryFile is 2D only for this version.");
+
+    void* base = nullptr;
+    size_t length = 0;
+    const T* coords = nullptr;
+    const uint64_t* offsets = nullptr;
+    uint64_t polygons = 0, vertices = 0;
+    uint32_t format_version = 0;
+
+    void unmap();
+
+public:
+    explicit GeometryFile(const std::string& path);
+    ~GeometryFile();
+
+    GeometryFile(GeometryFile&& other) noexcept;
+    GeometryFile& operator=(GeometryFile&& other) noexcept;
+    GeometryFile(const GeometryFile&) = delete;
+    GeometryFile& operator=(const GeometryFile&) = delete;
+
+    size_t size() const { return polygons; }
+    size_t vertex_count() const { return vertices; }
+    uint32_t version() const { return format_version; }
+
+    PolygonView<2, T> operator[](size_t i) const;
+
+    // Hint that polygon i will be read soon so its pages are fetched ahead
+    void prefetch(size_t i) const;
+};
+
+#include "GeometryFile.ipp"
+
+#endif // GEOMETRY_FILE_H
@@ -0,0 +1,196 @@
+#ifndef GEOMETRY_FILE_IPP
+#define GEOMETRY_FILE_IPP
+
+#include "GeometryFile.h"
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template <size_t D, typename T>
+GeometryWriter<D, T>::GeometryWriter(const std::string& path)
+    : out(path, std::ios::binary | std::ios::trunc) {
+    if (!out) throw std::runtime_error("Cannot open " + path + " for writing");
+    GeometryFileHeader placeholder{};
+    out.write(reinterpret_cast<const char*>(&placeholder), sizeof placeholder);
+}
+
+template <size_t D, typename T>
+GeometryWriter<D, T>::~GeometryWriter() {
+    try {
+        close();
+    } catch (...) {
+        // destructors must not throw; call close() to see errors
+    }
+}
+
+template <size_t D, typename T>
+void GeometryWriter<D, T>::pad_to(uint64_t alignment) {
+    static const char zeros[64] = {};
+    uint64_t pos = static_cast<uint64_t>(out.tellp());
+    out.write(zeros, static_cast<std::streamsize>((alignment - pos % alignment) % alignment));
+}
+
+template <size_t D, typename T>
+template <typename Poly>
+void GeometryWriter<D, T>::add(const Poly& poly) {
+    if (!out.is_open()) throw std::logic_error("GeometryWriter is closed");
+    const size_t n = poly.size();
+    buffer.resize(2 * n);
+    for (size_t i = 0; i < n; ++i) {
+        Point<2, T> p = poly[i];
+        buffer[2 * i] = p[0];
+        buffer[2 * i + 1] = p[1];
+    }
+    out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(T)));
+    if (!out) throw std::runtime_error("Write failed");
+    offsets.push_back(offsets.back() + n);
+}
+
+template <size_t D, typename T>
+void GeometryWriter<D, T>::close() {
+    if (!out.is_open()) return;
+    pad_to(64);
+    uint64_t offsets_pos = static_cast<uint64_t>(out.tellp());
+    out.write(reinterpret_cast<const char*>(offsets.data()),
+              static_cast<std::streamsize>(offsets.size() * sizeof(uint64_t)));
+
+    GeometryFileHeader h{};
+    std::memcpy(h.magic, GeometryFileHeader::magic_bytes, sizeof h.magic);
+    h.version = GeometryFileHeader::current_version;
+    h.header_size = sizeof(GeometryFileHeader);
+    h.byte_order = GeometryFileHeader::byte_order_mark;
+    h.coord_type = geometry_coord_type<T>();
+    h.dimension = 2;
+    h.polygon_count = offsets.size() - 1;
+    h.vertex_count = offsets.back();
+    h.coords_pos = sizeof(GeometryFileHeader);
+    h.offsets_pos = offsets_pos;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&h), sizeof h);
+    out.close();
+    if (!out) throw std::runtime_error("Write failed");
+}
+
+template <size_t D, typename T>
+GeometryFile<D, T>::GeometryFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open " + path + ": " + std::strerror(errno));
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        throw std::runtime_error("Cannot stat " + path + ": " + std::strerror(err));
+    }
+    length = static_cast<size_t>(st.st_size);
+    if (length < sizeof(GeometryFileHeader)) {
+        ::close(fd);
+        throw std::runtime_error(path + " is not a geometry file");
+    }
+    base = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    int err = errno;
+    ::close(fd);   // the mapping keeps the file alive
+    if (base == MAP_FAILED) {
+        base = nullptr;
+        throw std::runtime_error("Cannot map " + path + ": " + std::strerror(err));
+    }
+    // polygons are read in no particular order; don't read ahead of them
+    ::madvise(base, length, MADV_RANDOM);
+
+    try {
+        GeometryFileHeader h;
+        std::memcpy(&h, base, sizeof h);
+        if (std::memcmp(h.magic, GeometryFileHeader::magic_bytes, sizeof h.magic) != 0)
+            throw std::runtime_error(path + " is not a geometry file");
+        if (h.byte_order != GeometryFileHeader::byte_order_mark)
+            throw std::runtime_error(path + " was written with a different byte order");
+        if (h.version == 0 || h.version > GeometryFileHeader::current_version)
+            throw std::runtime_error(path + " has unsupported format version " + std::to_string(h.version));
+        if (h.header_size < sizeof(GeometryFileHeader) || h.dimension != 2)
+            throw std::runtime_error(path + " has an invalid header");
+        if (h.coord_type != geometry_coord_type<T>())
+            throw std::runtime_error(path + " stores a different coordinate type");
+
+        // both arrays must be aligned and lie inside the file
+        const uint64_t coord_bytes = h.vertex_count * 2 * sizeof(T);
+        const uint64_t offset_bytes = (h.polygon_count + 1) * sizeof(uint64_t);
+        bool fits = h.vertex_count <= length / (2 * sizeof(T)) && h.polygon_count < length / sizeof(uint64_t) &&
+                    h.coords_pos % alignof(T) == 0 && h.offsets_pos % alignof(uint64_t) == 0 &&
+                    h.coords_pos <= length && coord_bytes <= length - h.coords_pos &&
+                    h.offsets_pos <= length && offset_bytes <= length - h.offsets_pos;
+        if (!fits) throw std::runtime_error(path + " is truncated or corrupt");
+
+        const char* bytes = static_cast<const char*>(base);
+        coords = reinterpret_cast<const T*>(bytes + h.coords_pos);
+        offsets = reinterpret_cast<const uint64_t*>(bytes + h.offsets_pos);
+        polygons = h.polygon_count;
+        vertices = h.vertex_count;
+        format_version = h.version;
+        if (offsets[0] != 0 || offsets[polygons] != vertices)
+            throw std::runtime_error(path + " is truncated or corrupt");
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+template <size_t D, typename T>
+void GeometryFile<D, T>::unmap() {
+    if (base) ::munmap(base, length);
+    base = nullptr;
+    length = 0;
+}
+
+template <size_t D, typename T>
+GeometryFile<D, T>::~GeometryFile() {
+    unmap();
+}
+
+template <size_t D, typename T>
+GeometryFile<D, T>::GeometryFile(GeometryFile&& other) noexcept
+    : base(other.base), length(other.length), coords(other.coords), offsets(other.offsets),
+      polygons(other.polygons), vertices(other.vertices), format_version(other.format_version) {
+    other.base = nullptr;
+    other.length = 0;
+    other.polygons = other.vertices = 0;
+}
+
+template <size_t D, typename T>
+GeometryFile<D, T>& GeometryFile<D, T>::operator=(GeometryFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        base = other.base; length = other.length;
+        coords = other.coords; offsets = other.offsets;
+        polygons = other.polygons; vertices = other.vertices;
+        format_version = other.format_version;
+        other.base = nullptr;
+        other.length = 0;
+        other.polygons = other.vertices = 0;
+    }
+    return *this;
+}
+
+template <size_t D, typename T>
+PolygonView<2, T> GeometryFile<D, T>::operator[](size_t i) const {
+    if (i >= polygons) throw std::out_of_range("GeometryFile index out of range");
+    uint64_t b = offsets[i], e = offsets[i + 1];
+    if (b > e || e > vertices) throw std::runtime_error("Corrupt polygon offsets in geometry file");
+    return PolygonView<2, T>(coords + 2 * b, static_cast<size_t>(e - b));
+}
+
+template <size_t D, typename T>
+void GeometryFile<D, T>::prefetch(size_t i) const {
+    PolygonView<2, T> v = (*this)[i];
+    if (v.size() == 0) return;
+    const long page = ::sysconf(_SC_PAGESIZE);
+    uintptr_t from = reinterpret_cast<uintptr_t>(v.data());
+    uintptr_t to = reinterpret_cast<uintptr_t>(v.data() + 2 * v.size());
+    from -= from % page;
+    ::madvise(reinterpret_cast<void*>(from), to - from, MADV_WILLNEED);
+}
+
+#endif // GEOMETRY_FILE_IPP
@@ -0,0 +1,131 @@
+#include "GeometryFile.h"
+#include "../Ray/Ray.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+static Polygon<2, float> random_polygon(std::mt19937& rng, size_t n, float cx, float cy) {
+    std::uniform_real_distribution<float> radius(0.5f, 2.0f);
+    std::vector<Point<2, float>> pts;
+    for (size_t k = 0; k < n; ++k) {
+        float a = 2 * float(M_PI) * k / n, r = radius(rng);
+        pts.push_back(Point<2, float>{cx + r * std::cos(a), cy + r * std::sin(a)});
+    }
+    return Polygon<2, float>(pts);
+}
+
+int main() {
+    const std::string path = "/tmp/geometry_demo.cgeo";
+    const std::string text_path = "/tmp/geometry_demo.txt";
+
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> pos(-1000.0f, 1000.0f);
+    std::uniform_int_distribution<size_t> sides(3, 64);
+    std::vector<Polygon<2, float>> polys;
+    for (int i = 0; i < 100000; ++i) polys.push_back(random_polygon(rng, sides(rng), pos(rng), pos(rng)));
+
+    using ms = std::chrono::duration<double, std::milli>;
+    auto t0 = std::chrono::steady_clock::now();
+    {
+        GeometryWriter<2, float> writer(path);
+        for (const auto& p : polys) writer.add(p);
+        writer.close();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    {
+        // the same data as plain text, for comparison
+        std::ofstream text(text_path);
+        for (const auto& p : polys) {
+            text << p.size();
+            for (size_t i = 0; i < p.size(); ++i) text << ' ' << p[i][0] << ' ' << p[i][1];
+            text << '\n';
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+    GeometryFile<2, float> file(path);
+    auto t3 = std::chrono::steady_clock::now();
+    double mapped_area = 0;
+    for (size_t i = 0; i < file.size(); ++i) mapped_area += file[i].area();
+    auto t4 = std::chrono::steady_clock::now();
+
+    std::vector<Polygon<2, float>> parsed;
+    {
+        std::ifstream text(text_path);
+        std::string line;
+        while (std::getline(text, line)) {
+            std::istringstream in(line);
+            size_t n;
+            in >> n;
+            std::vector<Point<2, float>> pts(n);
+            for (auto& p : pts) in >> p[0] >> p[1];
+            parsed.emplace_back(std::move(pts));
+        }
+    }
+    auto t5 = std::chrono::steady_clock::now();
+
+    std::cout << polys.size() << " polygons, " << file.vertex_count() << " vertices, format v"
+              << file.version() << "\n";
+    std::cout << "Write binary: " << ms(t1 - t0).count() << " ms\n";
+    std::cout << "Open mapped file: " << ms(t3 - t2).count() << " ms, area over all views: "
+              << ms(t4 - t3).count() << " ms\n";
+    std::cout << "Parse text into Polygons: " << ms(t5 - t4).count() << " ms\n";
+
+    std::cout << "\n[TEST] Views round-trip every vertex: ";
+    size_t wrong = file.size() != polys.size();
+    for (size_t i = 0; i < polys.size() && !wrong; ++i) {
+        PolygonView<2, float> v = file[i];
+        wrong += v.size() != polys[i].size();
+        for (size_t k = 0; k < v.size() && !wrong; ++k) wrong += v[k] != polys[i][k];
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Views agree with Polygon on area, isInside, intersect and ray casts: ";
+    wrong = 0;
+    for (size_t i = 0; i < 2000; ++i) {
+        PolygonView<2, float> v = file[i];
+        const auto& p = polys[i];
+        Point<2, float> c = p.centroid(), q{pos(rng), pos(rng)};
+        LineSegment<2, float> seg(c, q);
+        Ray<2, float> ray(q, c - q);
+        wrong += v.area() != p.area() && std::abs(v.area() - p.area()) > 1e-5f * p.area();
+        wrong += v.isInside(c) != p.isInside(c);
+        wrong += v.intersect(seg) != p.intersect(seg);
+        wrong += v.intersect(file[i + 1]) != p.intersect(polys[i + 1]);
+        wrong += v.intersect(p) != true;
+        wrong += ray.intersect(v) != ray.intersect(p);
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Wrong coordinate type is rejected: ";
+    try {
+        GeometryFile<2, double> as_double(path);
+        std::cout << "FAIL\n";
+    } catch (const std::runtime_error&) {
+        std::cout << "PASS\n";
+    }
+
+    std::cout << "[TEST] Text file is rejected: ";
+    try {
+        GeometryFile<2, float> not_geometry(text_path);
+        std::cout << "FAIL\n";
+    } catch (const std::runtime_error&) {
+        std::cout << "PASS\n";
+    }
+
+    std::cout << "[TEST] Out-of-range index throws: ";
+    try {
+        file.prefetch(file.size());
+        std::cout << "FAIL\n";
+    } catch (const std::out_of_range&) {
+        std::cout << "PASS\n";
+    }
+
+    std::remove(path.c_str());
+    std::remove(text_path.c_str());
+    return mapped_area > 0 ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+#ifndef MESH_BVH_H
+#define MESH_BVH_H
+
+#include "TriangleMesh.h"
+#include "../SoA/SoAKernels.h"
+#include <vector>
+#include <span>
+#include <optional>
+#include <limits>
+#include <cstdint>
+
+// Bounding volume hierarchy over a TriangleMesh, split by the surface area
+// heuristic over binned triangle centroids. The BVH keeps its own copy of
+// each triangle as corner plus two edges, in leaf order, so it does not
+// refer back to the mesh after construction.
+//
+// Single rays walk the tree alone. The span overloads trace rays in packets
+// of packet_width (the SimdOps<T> width: 8 floats with AVX2, 4 with SSE2):
+// a packet descends into a node if any of its rays reaches the box, and
+// each triangle is tested against all of its rays at once. Packets pay off
+// for coherent rays, such as neighbouring camera pixels or shadow rays
+// towards one light.
+//
+// Packets give the single-ray answers whether or not the target has FMA:
+// both paths spell out the same fused or separate products (see mul_add in
+// SoAKernels.h), and each lane only takes hits from boxes its own slab test
+// reached. Hit or miss and occlusion agree exactly. The one exception is a
+// ray that hits two triangles within rounding of each other, as through a
+// shared edge or vertex. Boxes are visited in a different order, so either
+// triangle may be reported, and the t values differ only by the rounding
+// of the triangle test.
+template <size_t D, typename T>
+class MeshBVH {
+    static_assert(D == 3, "MeshBVH is 3D only for this version.");
+
+    struct Tri {
+        Point<3, T> a;
+        Vector<3, T> e1, e2;
+    };
+
+    struct Node {
+        T lo[3], hi[3];
+        uint32_t offset;   // leaf: first triangle, interior: right child
+        uint32_t count;    // 0 for interior nodes
+    };
+
+    struct Prim {
+        T lo[3], hi[3], c[3];
+        uint32_t id;
+    };
+
+    static constexpr uint32_t MAX_LEAF = 8;
+    // A box test pair relative to one triangle test; above 1 so leaves hold
+    // a few triangles for a packet to test together
+    static constexpr T TRAVERSAL_COST = 2;
+    static constexpr size_t BINS = 16;
+    static constexpr size_t MAX_DEPTH = 64;
+    // Slab exits are scaled by 1 + 2 gamma(3) (Ize, "Robust BVH Ray
+    // Traversal"), so rounding never culls a box the ray reaches before
+    // t_max; which triangles a ray gets to test then does not depend on the
+    // order the boxes were visited in
+    static constexpr T SLAB_SLACK = 1 + 3 * std::numeric_limits<T>::epsilon();
+
+    std::vector<Tri> tris;
+    std::vector<uint32_t> ids;   // mesh triangle of each slot in `tris`
+    std::vector<Node> nodes;
+
+    uint32_t build_node(std::vector<Prim>& prims, uint32_t first, uint32_t count, size_t depth);
+    bool hit_box(const Node& n, const T o[3], const T inv[3], T t_max) const;
+    // Whether the left child of interior node `parent` comes first along
+    // `axis`, walking forward or backward
+    bool left_first(uint32_t parent, int axis, bool forward) const;
+
+    template <bool AnyHit>
+    std::optional<MeshHit<D, T>> trace(const Ray<3, T>& r, T t_max) const;
+    template <bool AnyHit>
+    void trace_packet(const Ray<3, T>* rays, size_t count, T t_max, std::optional<MeshHit<D, T>>* hits,
+                      uint8_t* blocked) const;
+
+public:
+    using Hit = MeshHit<D, T>;
+    static constexpr size_t packet_width = SimdOps<T>::width;
+
+    MeshBVH() = default;
+    // Throws std::invalid_argument for a mesh with 2^32 or more triangles
+    explicit MeshBVH(const TriangleMesh<D, T>& mesh);
+
+    size_t size() const { return tris.size(); }
+    size_t node_count() const { return nodes.size(); }
+
+    // Nearest hit with 0 <= t < t_max
+    std::optional<Hit> closest_hit(const Ray<3, T>& r, T t_max = std::numeric_limits<T>::max()) const;
+    // Whether anything is hit with 0 <= t < t_max; stops at the first hit
+    bool occluded(const Ray<3, T>& r, T t_max = std::numeric_limits<T>::max()) const;
+
+    // out[i] answers rays[i]; throws std::invalid_argument if `out` is
+    // shorter than `rays`. occluded returns the number of blocked rays.
+    void closest_hit(std::span<const Ray<3, T>> rays, std::span<std::optional<Hit>> out,
+                     T t_max = std::numeric_limits<T>::max()) const;
+    size_t occluded(std::span<const Ray<3, T>> rays, std::span<uint8_t> out,
+                    T t_max = std::numeric_limits<T>::max()) const;
+};
+
+#include "MeshBVH.ipp"
+
+#endif // MESH_BVH_H
@@ -0,0 +1,379 @@
+#ifndef MESH_BVH_IPP
+#define MESH_BVH_IPP
+
+#include "MeshBVH.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+template <size_t D, typename T>
+MeshBVH<D, T>::MeshBVH(const TriangleMesh<D, T>& mesh) {
+    const size_t n = mesh.size();
+    if (n > std::numeric_limits<uint32_t>::max())
+        throw std::invalid_argument("MeshBVH holds at most 2^32 - 1 triangles");
+    const auto& verts = mesh.vertices();
+    const auto& idx = mesh.indices();
+
+    std::vector<Prim> prims(n);
+    for (size_t i = 0; i < n; ++i) {
+        Prim& p = prims[i];
+        for (int k = 0; k < 3; ++k) {
+            T a = verts[idx[3 * i]].get(k), b = verts[idx[3 * i + 1]].get(k), c = verts[idx[3 * i + 2]].get(k);
+            p.lo[k] = std::min({a, b, c});
+            p.hi[k] = std::max({a, b, c});
+            p.c[k] = (p.lo[k] + p.hi[k]) / 2;
+        }
+        p.id = static_cast<uint32_t>(i);
+    }
+    nodes.reserve(n);
+    if (n) build_node(prims, 0, static_cast<uint32_t>(n), 0);
+
+    tris.resize(n);
+    ids.resize(n);
+    for (size_t slot = 0; slot < n; ++slot) {
+        uint32_t i = prims[slot].id;
+        const Point<3, T>& a = verts[idx[3 * i]];
+        tris[slot] = {a, verts[idx[3 * i + 1]] - a, verts[idx[3 * i + 2]] - a};
+        ids[slot] = i;
+    }
+}
+
+template <size_t D, typename T>
+uint32_t MeshBVH<D, T>::build_node(std::vector<Prim>& prims, uint32_t first, uint32_t count, size_t depth) {
+    uint32_t index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back({});
+
+    Node node{};
+    T clo[3], chi[3];
+    for (int k = 0; k < 3; ++k) {
+        node.lo[k] = clo[k] = std::numeric_limits<T>::max();
+        node.hi[k] = chi[k] = std::numeric_limits<T>::lowest();
+    }
+    for (uint32_t i = first; i < first + count; ++i)
+        for (int k = 0; k < 3; ++k) {
+            node.lo[k] = std::min(node.lo[k], prims[i].lo[k]);
+            node.hi[k] = std::max(node.hi[k], prims[i].hi[k]);
+            clo[k] = std::min(clo[k], prims[i].c[k]);
+            chi[k] = std::max(chi[k], prims[i].c[k]);
+        }
+    auto half_area = [](const T lo[3], const T hi[3]) {
+        T x = hi[0] - lo[0], y = hi[1] - lo[1], z = hi[2] - lo[2];
+        return x * y + y * z + z * x;
+    };
+    auto leaf = [&] {
+        node.offset = first;
+        node.count = count;
+        nodes[index] = node;
+        return index;
+    };
+    if (count == 1 || depth + 1 >= MAX_DEPTH) return leaf();
+
+    // Binned SAH: a split costs TRAVERSAL_COST + (A_left * N_left + A_right *
+    // N_right) / A, in units of one triangle test, against N for a leaf
+    struct Bin {
+        T lo[3], hi[3];
+        uint32_t count;
+    };
+    const T area = half_area(node.lo, node.hi);
+    int best_axis = -1;
+    size_t best_split = 0;
+    T best_cost = static_cast<T>(count);
+    auto bin_of = [&](const Prim& p, int axis) {
+        T scale = T(BINS) / (chi[axis] - clo[axis]);
+        return std::min(BINS - 1, static_cast<size_t>((p.c[axis] - clo[axis]) * scale));
+    };
+    for (int axis = 0; axis < 3 && area > 0; ++axis) {
+        if (!(chi[axis] > clo[axis])) continue;
+        Bin bins[BINS];
+        for (auto& b : bins) {
+            for (int k = 0; k < 3; ++k) {
+                b.lo[k] = std::numeric_limits<T>::max();
+                b.hi[k] = std::numeric_limits<T>::lowest();
+            }
+            b.count = 0;
+        }
+        for (uint32_t i = first; i < first + count; ++i) {
+            Bin& b = bins[bin_of(prims[i], axis)];
+            for (int k = 0; k < 3; ++k) {
+                b.lo[k] = std::min(b.lo[k], prims[i].lo[k]);
+                b.hi[k] = std::max(b.hi[k], prims[i].hi[k]);
+            }
+            ++b.count;
+        }
+        // right_cost[s]: A * N of bins s.. as one box
+        T right_cost[BINS];
+        Bin acc = bins[BINS - 1];
+        right_cost[BINS - 1] = acc.count ? half_area(acc.lo, acc.hi) * acc.count : 0;
+        for (size_t s = BINS - 1; s-- > 1;) {
+            for (int k = 0; k < 3; ++k) {
+                acc.lo[k] = std::min(acc.lo[k], bins[s].lo[k]);
+                acc.hi[k] = std::max(acc.hi[k], bins[s].hi[k]);
+            }
+            acc.count += bins[s].count;
+            right_cost[s] = acc.count ? half_area(acc.lo, acc.hi) * acc.count : 0;
+        }
+        acc = bins[0];
+        for (size_t s = 1; s < BINS; ++s) {
+            if (acc.count && acc.count < count) {
+                T cost = TRAVERSAL_COST + (half_area(acc.lo, acc.hi) * acc.count + right_cost[s]) / area;
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = s;
+                }
+            }
+            for (int k = 0; k < 3; ++k) {
+                acc.lo[k] = std::min(acc.lo[k], bins[s].lo[k]);
+                acc.hi[k] = std::max(acc.hi[k], bins[s].hi[k]);
+            }
+            acc.count += bins[s].count;
+        }
+    }
+
+    uint32_t left_count = 0;
+    if (best_axis >= 0) {
+        auto mid = std::partition(prims.begin() + first, prims.begin() + first + count,
+                                  [&](const Prim& p) { return bin_of(p, best_axis) < best_split; });
+        left_count = static_cast<uint32_t>(mid - (prims.begin() + first));
+    } else if (count > MAX_LEAF) {
+        // No split beats a leaf, but the leaf would be too big: halve it
+        int axis = 0;
+        for (int k = 1; k < 3; ++k)
+            if (chi[k] - clo[k] > chi[axis] - clo[axis]) axis = k;
+        left_count = count / 2;
+        std::nth_element(prims.begin() + first, prims.begin() + first + left_count, prims.begin() + first + count,
+                         [axis](const Prim& a, const Prim& b) { return a.c[axis] < b.c[axis]; });
+    }
+    if (left_count == 0 || left_count == count) return leaf();
+
+    build_node(prims, first, left_count, depth + 1);
+    node.offset = build_node(prims, first + left_count, count - left_count, depth + 1);
+    node.count = 0;
+    nodes[index] = node;
+    return index;
+}
+
+template <size_t D, typename T>
+bool MeshBVH<D, T>::hit_box(const Node& n, const T o[3], const T inv[3], T t_max) const {
+    T t0 = 0, t1 = t_max;
+    for (int k = 0; k < 3; ++k) {
+        T a = (n.lo[k] - o[k]) * inv[k];
+        T b = (n.hi[k] - o[k]) * inv[k];
+        if (a > b) std::swap(a, b);
+        // NaN (origin on a slab of a flat box) leaves t0/t1 untouched
+        t0 = std::max(t0, a);
+        t1 = std::min(t1, b);
+        if (t0 > t1 * SLAB_SLACK) return false;
+    }
+    return true;
+}
+
+template <size_t D, typename T>
+bool MeshBVH<D, T>::left_first(uint32_t parent, int axis, bool forward) const {
+    const Node& l = nodes[parent + 1];
+    const Node& r = nodes[nodes[parent].offset];
+    return forward ? l.lo[axis] <= r.lo[axis] : l.hi[axis] >= r.hi[axis];
+}
+
+template <size_t D, typename T>
+template <bool AnyHit>
+std::optional<MeshHit<D, T>> MeshBVH<D, T>::trace(const Ray<3, T>& r, T t_max) const {
+    std::optional<Hit> best;
+    if (nodes.empty()) return best;
+
+    T o[3], inv[3];
+    int axis = 0;
+    for (int k = 0; k < 3; ++k) {
+        o[k] = r.origin.get(k);
+        inv[k] = T(1) / r.direction.get(k);
+        if (std::abs(r.direction.get(k)) > std::abs(r.direction.get(axis))) axis = k;
+    }
+    const bool forward = r.direction.get(axis) >= 0;
+
+    uint32_t stack[MAX_DEPTH];
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const uint32_t at = stack[--top];
+        const Node& n = nodes[at];
+        if (!hit_box(n, o, inv, t_max)) continue;
+        if (n.count > 0) {
+            for (uint32_t i = n.offset; i < n.offset + n.count; ++i) {
+                const Tri& tri = tris[i];
+                if (auto h = intersect_triangle(r, tri.a, tri.e1, tri.e2, t_max)) {
+                    best = Hit{ids[i], (*h)[0], (*h)[1], (*h)[2]};
+                    if constexpr (AnyHit) return best;
+                    t_max = (*h)[0];
+                }
+            }
+            continue;
+        }
+        // push the farther child first so the nearer one is popped next
+        bool near_left = left_first(at, axis, forward);
+        stack[top++] = near_left ? n.offset : at + 1;
+        stack[top++] = near_left ? at + 1 : n.offset;
+    }
+    return best;
+}
+
+// Lanes past `count` start with t_max = -1, which no box or triangle passes;
+// for occlusion a lane is retired the same way once it is blocked
+template <size_t D, typename T>
+template <bool AnyHit>
+void MeshBVH<D, T>::trace_packet(const Ray<3, T>* rays, size_t count, T t_max, std::optional<Hit>* hits,
+                                 uint8_t* blocked) const {
+    using S = SimdOps<T>;
+    constexpr size_t W = S::width;
+    constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    T lane[10][W];   // origin, direction, inverse direction, t_max
+    for (size_t k = 0; k < W; ++k) {
+        const Ray<3, T>& r = rays[std::min(k, count - 1)];
+        for (int c = 0; c < 3; ++c) {
+            lane[c][k] = r.origin.get(c);
+            lane[3 + c][k] = r.direction.get(c);
+            lane[6 + c][k] = T(1) / r.direction.get(c);
+        }
+        lane[9][k] = k < count ? t_max : T(-1);
+    }
+    typename S::reg o[3], d[3], inv[3];
+    for (int c = 0; c < 3; ++c) {
+        o[c] = S::load(lane[c]);
+        d[c] = S::load(lane[3 + c]);
+        inv[c] = S::load(lane[6 + c]);
+    }
+    auto tm = S::load(lane[9]);
+    auto bu = S::set1(0), bv = S::set1(0);
+    uint32_t slot[W];
+    std::fill(slot, slot + W, none);
+    const int live = static_cast<int>((1u << count) - 1);
+    int done = 0;
+
+    int axis = 0;
+    for (int k = 1; k < 3; ++k)
+        if (std::abs(rays[0].direction.get(k)) > std::abs(rays[0].direction.get(axis))) axis = k;
+    const bool forward = rays[0].direction.get(axis) >= 0;
+    const auto zero = S::set1(0), one = S::set1(1), retired = S::set1(-1), slack = S::set1(SLAB_SLACK);
+
+    // Each entry carries the lanes whose own slab tests reached it, so a
+    // lane only takes hits from leaves its single-ray walk would visit too
+    uint32_t stack[MAX_DEPTH];
+    typename S::reg reached[MAX_DEPTH];
+    size_t top = 0;
+    if (!nodes.empty()) {
+        stack[top] = 0;
+        reached[top++] = S::ge(zero, zero);
+    }
+    while (top > 0) {
+        --top;
+        const uint32_t at = stack[top];
+        const Node& n = nodes[at];
+        // Slab test per lane; accumulators go second so a NaN slab is ignored
+        auto t0 = zero, t1 = tm;
+        for (int c = 0; c < 3; ++c) {
+            auto a = S::mul(S::sub(S::set1(n.lo[c]), o[c]), inv[c]);
+            auto b = S::mul(S::sub(S::set1(n.hi[c]), o[c]), inv[c]);
+            t0 = S::max(S::min(a, b), t0);
+            t1 = S::min(S::max(a, b), t1);
+        }
+        const auto in_box = S::bit_and(S::ge(S::mul(t1, slack), t0), reached[top]);
+        if (!S::movemask(in_box)) continue;
+
+        if (n.count == 0) {
+            bool near_left = left_first(at, axis, forward);
+            stack[top] = near_left ? n.offset : at + 1;
+            reached[top++] = in_box;
+            stack[top] = near_left ? at + 1 : n.offset;
+            reached[top++] = in_box;
+            continue;
+        }
+        for (uint32_t i = n.offset; i < n.offset + n.count; ++i) {
+            // Moller-Trumbore, same operation order as intersect_triangle
+            const Tri& tri = tris[i];
+            const auto e1x = S::set1(tri.e1.get(0)), e1y = S::set1(tri.e1.get(1)), e1z = S::set1(tri.e1.get(2));
+            const auto e2x = S::set1(tri.e2.get(0)), e2y = S::set1(tri.e2.get(1)), e2z = S::set1(tri.e2.get(2));
+            auto px = S::mul_sub(d[1], e2z, S::mul(d[2], e2y));
+            auto py = S::mul_sub(d[2], e2x, S::mul(d[0], e2z));
+            auto pz = S::mul_sub(d[0], e2y, S::mul(d[1], e2x));
+            auto det = S::mul_add(e1z, pz, S::mul_add(e1y, py, S::mul(e1x, px)));
+            auto inv_det = S::div(one, det);
+            auto sx = S::sub(o[0], S::set1(tri.a.get(0)));
+            auto sy = S::sub(o[1], S::set1(tri.a.get(1)));
+            auto sz = S::sub(o[2], S::set1(tri.a.get(2)));
+            auto u = S::mul(S::mul_add(sz, pz, S::mul_add(sy, py, S::mul(sx, px))), inv_det);
+            auto qx = S::mul_sub(sy, e1z, S::mul(sz, e1y));
+            auto qy = S::mul_sub(sz, e1x, S::mul(sx, e1z));
+            auto qz = S::mul_sub(sx, e1y, S::mul(sy, e1x));
+            auto v = S::mul(S::mul_add(d[2], qz, S::mul_add(d[1], qy, S::mul(d[0], qx))), inv_det);
+            auto t = S::mul(S::mul_add(e2z, qz, S::mul_add(e2y, qy, S::mul(e2x, qx))), inv_det);
+            // A zero det makes u and v infinite or NaN, which fails below
+            auto hit = S::bit_and(S::bit_and(S::bit_and(S::ge(u, zero), S::ge(v, zero)), in_box),
+                                  S::bit_and(S::ge(one, S::add(u, v)),
+                                             S::bit_and(S::ge(t, zero), S::gt(tm, t))));
+            const int mask = S::movemask(hit);
+            if (!mask) continue;
+            if constexpr (AnyHit) {
+                tm = S::select(hit, retired, tm);
+                done |= mask;
+                if (done == live) {
+                    top = 0;
+                    break;
+                }
+            } else {
+                tm = S::select(hit, t, tm);
+                bu = S::select(hit, u, bu);
+                bv = S::select(hit, v, bv);
+                for (size_t k = 0; k < W; ++k)
+                    if (mask >> k & 1) slot[k] = i;
+            }
+        }
+    }
+
+    if constexpr (AnyHit) {
+        for (size_t k = 0; k < count; ++k) blocked[k] = done >> k & 1;
+    } else {
+        T ts[W], us[W], vs[W];
+        S::store(ts, tm);
+        S::store(us, bu);
+        S::store(vs, bv);
+        for (size_t k = 0; k < count; ++k)
+            hits[k] = slot[k] == none ? std::nullopt : std::optional<Hit>(Hit{ids[slot[k]], ts[k], us[k], vs[k]});
+    }
+}
+
+template <size_t D, typename T>
+std::optional<MeshHit<D, T>> MeshBVH<D, T>::closest_hit(const Ray<3, T>& r, T t_max) const {
+    return trace<false>(r, t_max);
+}
+
+template <size_t D, typename T>
+bool MeshBVH<D, T>::occluded(const Ray<3, T>& r, T t_max) const {
+    return trace<true>(r, t_max).has_value();
+}
+
+template <size_t D, typename T>
+void MeshBVH<D, T>::closest_hit(std::span<const Ray<3, T>> rays, std::span<std::optional<Hit>> out, T t_max) const {
+    if (out.size() < rays.size())
+        throw std::invalid_argument("Output buffer smaller than ray batch");
+    if constexpr (packet_width > 1) {
+        for (size_t i = 0; i < rays.size(); i += packet_width)
+            trace_packet<false>(&rays[i], std::min(packet_width, rays.size() - i), t_max, &out[i], nullptr);
+    } else {
+        for (size_t i = 0; i < rays.size(); ++i) out[i] = trace<false>(rays[i], t_max);
+    }
+}
+
+template <size_t D, typename T>
+size_t MeshBVH<D, T>::occluded(std::span<const Ray<3, T>> rays, std::span<uint8_t> out, T t_max) const {
+    if (out.size() < rays.size())
+        throw std::invalid_argument("Output buffer smaller than ray batch");
+    if constexpr (packet_width > 1) {
+        for (size_t i = 0; i < rays.size(); i += packet_width)
+            trace_packet<true>(&rays[i], std::min(packet_width, rays.size() - i), t_max, nullptr, &out[i]);
+    } else {
+        for (size_t i = 0; i < rays.size(); ++i) out[i] = trace<true>(rays[i], t_max).has_value();
+    }
+    return static_cast<size_t>(std::count(out.begin(), out.begin() + rays.size(), uint8_t(1)));
+}
+
+#endif // MESH_BVH_IPP
@@ -0,0 +1,64 @@
+#ifndef TRIANGLE_MESH_H
+#define TRIANGLE_MESH_H
+
+#include "../Point/Point.h"
+#include "../Vector/Vector_new.h"
+#include "../Ray/Ray.h"
+#include "../SoA/SoAKernels.h"
+#include <vector>
+#include <array>
+#include <optional>
+#include <limits>
+#include <cstdint>
+
+template <size_t D, typename T>
+struct MeshHit {
+    size_t triangle;
+    T t;
+    T u, v;   // barycentric weights of corners 1 and 2; corner 0 has 1 - u - v
+};
+
+// Moller-Trumbore ray/triangle test against corner a and edges e1 = b - a,
+// e2 = c - a. Returns (t, u, v) for a hit with 0 <= t < t_max. Rays in the
+// triangle's plane never hit. Not watertight: a ray through a shared edge
+// can miss both triangles by a rounding error.
+template <typename T>
+std::optional<std::array<T, 3>> intersect_triangle(const Ray<3, T>& r, const Point<3, T>& a, const Vector<3, T>& e1,
+                                                   const Vector<3, T>& e2, T t_max = std::numeric_limits<T>::max());
+
+// Indexed triangle mesh: shared vertices plus three indices per triangle.
+// Ray queries here test every triangle; build a MeshBVH to cast many rays.
+template <size_t D, typename T>
+class TriangleMesh {
+    static_assert(D == 3, "TriangleMesh is 3D only for this version.");
+
+    std::vector<Point<3, T>> verts;
+    std::vector<uint32_t> idx;
+
+public:
+    using Hit = MeshHit<D, T>;
+
+    TriangleMesh() = default;
+    // Throws std::invalid_argument if the index count is not a multiple of
+    // three, an index is out of range, or there are 2^32 or more vertices
+    TriangleMesh(std::vector<Point<3, T>> vertices, std::vector<uint32_t> indices);
+
+    size_t size() const { return idx.size() / 3; }
+    size_t vertex_count() const { return verts.size(); }
+    const std::vector<Point<3, T>>& vertices() const { return verts; }
+    const std::vector<uint32_t>& indices() const { return idx; }
+
+    // Corners of triangle i; throws std::out_of_range
+    std::array<Point<3, T>, 3> operator[](size_t i) const;
+    // (b - a) x (c - a): counter-clockwise winding faces along it, and its
+    // length is twice the area
+    Vector<3, T> normal(size_t i) const;
+    T area() const;
+
+    std::optional<Hit> closest_hit(const Ray<3, T>& r, T t_max = std::numeric_limits<T>::max()) const;
+    bool occluded(const Ray<3, T>& r, T t_max = std::numeric_limits<T>::max()) const;
+};
+
+#include "TriangleMesh.ipp"
+
+#endif // TRIANGLE_MESH_H
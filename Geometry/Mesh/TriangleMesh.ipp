@@ -0,0 +1,90 @@
+#ifndef TRIANGLE_MESH_IPP
+#define TRIANGLE_MESH_IPP
+
+#include "TriangleMesh.h"
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+// Written out per component with ScalarOps, in the same operation order as
+// the packet kernel in MeshBVH. Each product is fused or rounded on its own
+// explicitly, so single rays and packets round identically whether or not
+// the target has FMA.
+template <typename T>
+std::optional<std::array<T, 3>> intersect_triangle(const Ray<3, T>& r, const Point<3, T>& a, const Vector<3, T>& e1,
+                                                   const Vector<3, T>& e2, T t_max) {
+    using S = ScalarOps<T>;
+    const T dx = r.direction.get(0), dy = r.direction.get(1), dz = r.direction.get(2);
+    const T e1x = e1.get(0), e1y = e1.get(1), e1z = e1.get(2);
+    const T e2x = e2.get(0), e2y = e2.get(1), e2z = e2.get(2);
+    const T px = S::mul_sub(dy, e2z, dz * e2y);
+    const T py = S::mul_sub(dz, e2x, dx * e2z);
+    const T pz = S::mul_sub(dx, e2y, dy * e2x);
+    const T det = S::mul_add(e1z, pz, S::mul_add(e1y, py, e1x * px));
+    if (det == 0) return std::nullopt;
+    const T inv = T(1) / det;
+
+    const T sx = r.origin.get(0) - a.get(0), sy = r.origin.get(1) - a.get(1), sz = r.origin.get(2) - a.get(2);
+    const T u = S::mul_add(sz, pz, S::mul_add(sy, py, sx * px)) * inv;
+    const T qx = S::mul_sub(sy, e1z, sz * e1y);
+    const T qy = S::mul_sub(sz, e1x, sx * e1z);
+    const T qz = S::mul_sub(sx, e1y, sy * e1x);
+    const T v = S::mul_add(dz, qz, S::mul_add(dy, qy, dx * qx)) * inv;
+    const T t = S::mul_add(e2z, qz, S::mul_add(e2y, qy, e2x * qx)) * inv;
+    if (u >= 0 && v >= 0 && u + v <= 1 && t >= 0 && t < t_max) return std::array<T, 3>{t, u, v};
+    return std::nullopt;
+}
+
+template <size_t D, typename T>
+TriangleMesh<D, T>::TriangleMesh(std::vector<Point<3, T>> vertices, std::vector<uint32_t> indices)
+    : verts(std::move(vertices)), idx(std::move(indices)) {
+    if (idx.size() % 3 != 0)
+        throw std::invalid_argument("TriangleMesh index count must be a multiple of 3");
+    if (verts.size() > std::numeric_limits<uint32_t>::max())
+        throw std::invalid_argument("TriangleMesh holds at most 2^32 - 1 vertices");
+    for (uint32_t i : idx)
+        if (i >= verts.size()) throw std::invalid_argument("TriangleMesh index out of range");
+}
+
+template <size_t D, typename T>
+std::array<Point<3, T>, 3> TriangleMesh<D, T>::operator[](size_t i) const {
+    if (i >= size()) throw std::out_of_range("TriangleMesh index out of range");
+    return {verts[idx[3 * i]], verts[idx[3 * i + 1]], verts[idx[3 * i + 2]]};
+}
+
+template <size_t D, typename T>
+Vector<3, T> TriangleMesh<D, T>::normal(size_t i) const {
+    auto [a, b, c] = (*this)[i];
+    return Vector<3, T>::cross_product(b - a, c - a);
+}
+
+template <size_t D, typename T>
+T TriangleMesh<D, T>::area() const {
+    T sum = 0;
+    for (size_t i = 0; i < size(); ++i) sum += std::sqrt(normal(i).squared_magnitude()) / 2;
+    return sum;
+}
+
+template <size_t D, typename T>
+std::optional<MeshHit<D, T>> TriangleMesh<D, T>::closest_hit(const Ray<3, T>& r, T t_max) const {
+    std::optional<Hit> best;
+    for (size_t i = 0; i < size(); ++i) {
+        const Point<3, T>& a = verts[idx[3 * i]];
+        if (auto h = intersect_triangle(r, a, verts[idx[3 * i + 1]] - a, verts[idx[3 * i + 2]] - a, t_max)) {
+            best = Hit{i, (*h)[0], (*h)[1], (*h)[2]};
+            t_max = (*h)[0];
+        }
+    }
+    return best;
+}
+
+template <size_t D, typename T>
+bool TriangleMesh<D, T>::occluded(const Ray<3, T>& r, T t_max) const {
+    for (size_t i = 0; i < size(); ++i) {
+        const Point<3, T>& a = verts[idx[3 * i]];
+        if (intersect_triangle(r, a, verts[idx[3 * i + 1]] - a, verts[idx[3 * i + 2]] - a, t_max)) return true;
+    }
+    return false;
+}
+
+#endif // TRIANGLE_MESH_IPP
@@ -0,0 +1,216 @@
+#include "MeshBVH.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using ms = std::chrono::duration<double, std::milli>;
+using P3 = Point<3, float>;
+using V3 = Vector<3, float>;
+
+// Rolling height field over [-1, 1]^2 with n x n vertices
+static TriangleMesh<3, float> terrain(size_t n, std::mt19937& rng) {
+    std::uniform_real_distribution<float> noise(-0.01f, 0.01f);
+    std::vector<P3> verts;
+    for (size_t j = 0; j < n; ++j)
+        for (size_t i = 0; i < n; ++i) {
+            float x = 2.0f * i / (n - 1) - 1, y = 2.0f * j / (n - 1) - 1;
+            verts.push_back(P3{x, y, 0.15f * std::sin(5 * x) * std::cos(7 * y) + noise(rng)});
+        }
+    std::vector<uint32_t> idx;
+    for (uint32_t j = 0; j + 1 < n; ++j)
+        for (uint32_t i = 0; i + 1 < n; ++i) {
+            uint32_t a = j * n + i, b = a + 1, c = a + n, d = c + 1;
+            idx.insert(idx.end(), {a, b, d, a, d, c});
+        }
+    return TriangleMesh<3, float>(std::move(verts), std::move(idx));
+}
+
+// Closed UV sphere, counter-clockwise seen from outside
+static TriangleMesh<3, float> sphere(P3 centre, float radius, uint32_t rings, uint32_t segments) {
+    std::vector<P3> verts{centre + V3{0, 0, -radius}};
+    for (uint32_t r = 1; r < rings; ++r)
+        for (uint32_t s = 0; s < segments; ++s) {
+            float phi = float(M_PI) * r / rings - float(M_PI) / 2, theta = 2 * float(M_PI) * s / segments;
+            verts.push_back(centre + V3{radius * std::cos(phi) * std::cos(theta),
+                                        radius * std::cos(phi) * std::sin(theta), radius * std::sin(phi)});
+        }
+    verts.push_back(centre + V3{0, 0, radius});
+    const uint32_t top = static_cast<uint32_t>(verts.size() - 1);
+    auto at = [&](uint32_t r, uint32_t s) { return 1 + (r - 1) * segments + s % segments; };
+    std::vector<uint32_t> idx;
+    for (uint32_t s = 0; s < segments; ++s) {
+        idx.insert(idx.end(), {0, at(1, s + 1), at(1, s)});
+        idx.insert(idx.end(), {top, at(rings - 1, s), at(rings - 1, s + 1)});
+        for (uint32_t r = 1; r + 1 < rings; ++r)
+            idx.insert(idx.end(), {at(r, s), at(r, s + 1), at(r + 1, s + 1), at(r, s), at(r + 1, s + 1), at(r + 1, s)});
+    }
+    return TriangleMesh<3, float>(std::move(verts), std::move(idx));
+}
+
+// Pinhole camera rays, row by row, so neighbouring rays share a packet
+static std::vector<Ray<3, float>> camera(size_t w, size_t h) {
+    const P3 eye{0, -2.2f, 1.4f};
+    std::vector<Ray<3, float>> rays;
+    rays.reserve(w * h);
+    for (size_t y = 0; y < h; ++y)
+        for (size_t x = 0; x < w; ++x) {
+            float sx = (2.0f * x / w - 1) * 0.8f, sy = (1 - 2.0f * y / h) * 0.6f;
+            rays.emplace_back(eye, V3{sx, 1, sy - 0.6f});
+        }
+    return rays;
+}
+
+static std::vector<Ray<3, float>> scattered(std::mt19937& rng, size_t n) {
+    std::uniform_real_distribution<float> pos(-1.5f, 1.5f);
+    std::normal_distribution<float> dir;
+    std::vector<Ray<3, float>> rays;
+    for (size_t i = 0; i < n; ++i) rays.emplace_back(P3{pos(rng), pos(rng), pos(rng)}, V3{dir(rng), dir(rng), dir(rng)});
+    return rays;
+}
+
+static bool same_hit(const std::optional<MeshHit<3, float>>& a, const std::optional<MeshHit<3, float>>& b) {
+    if (a.has_value() != b.has_value()) return false;
+    return !a || std::abs(a->t - b->t) <= 1e-5f * (1 + std::abs(b->t));
+}
+
+int main() {
+    std::mt19937 rng(3);
+
+    // Scene: terrain plus a sphere resting on it, as one mesh
+    auto ground = terrain(1024, rng);
+    auto ball = sphere(P3{0.3f, 0.2f, 0.35f}, 0.3f, 256, 512);
+    std::vector<P3> verts = ground.vertices();
+    std::vector<uint32_t> idx = ground.indices();
+    const uint32_t base = static_cast<uint32_t>(verts.size());
+    verts.insert(verts.end(), ball.vertices().begin(), ball.vertices().end());
+    for (uint32_t i : ball.indices()) idx.push_back(base + i);
+    TriangleMesh<3, float> mesh(std::move(verts), std::move(idx));
+
+    auto t0 = std::chrono::steady_clock::now();
+    MeshBVH<3, float> bvh(mesh);
+    auto t1 = std::chrono::steady_clock::now();
+    std::cout << "=== MESH BVH ===\n" << mesh.size() << " triangles, " << bvh.node_count() << " nodes, built in "
+              << ms(t1 - t0).count() << " ms, packets of " << bvh.packet_width << "\n";
+
+    auto primary = camera(1280, 720);
+    const size_t n = primary.size();
+    std::vector<std::optional<MeshHit<3, float>>> single(n), packed(n);
+    auto rate = [](size_t rays, ms time) { return rays / time.count() / 1000; };   // Mrays/s
+
+    t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i) single[i] = bvh.closest_hit(primary[i]);
+    t1 = std::chrono::steady_clock::now();
+    bvh.closest_hit(primary, packed);
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "Primary closest hit: single " << rate(n, t1 - t0) << " Mrays/s, packets " << rate(n, t2 - t1)
+              << " Mrays/s\n";
+
+    // Shadow rays towards a point light from every primary hit
+    const P3 light{1.5f, -1.0f, 2.5f};
+    std::vector<Ray<3, float>> shadow;
+    for (size_t i = 0; i < n; ++i)
+        if (single[i]) {
+            P3 p = primary[i].at(single[i]->t);
+            V3 normal = mesh.normal(single[i]->triangle);
+            normal = normal * (1e-4f / std::sqrt(normal.squared_magnitude()));
+            if (V3::dot_product(normal, primary[i].direction) > 0) normal = normal * -1.0f;
+            shadow.emplace_back(p + normal, light - p);
+        }
+    std::vector<uint8_t> blocked_single(shadow.size()), blocked_packed(shadow.size());
+    t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < shadow.size(); ++i) blocked_single[i] = bvh.occluded(shadow[i], 1.0f);
+    t1 = std::chrono::steady_clock::now();
+    size_t in_shadow = bvh.occluded(shadow, blocked_packed, 1.0f);
+    t2 = std::chrono::steady_clock::now();
+    std::cout << "Shadow occlusion:    single " << rate(shadow.size(), t1 - t0) << " Mrays/s, packets "
+              << rate(shadow.size(), t2 - t1) << " Mrays/s (" << in_shadow << " of " << shadow.size()
+              << " in shadow)\n";
+
+    // Incoherent rays: packets rarely agree on a path, so expect no gain
+    auto random_rays = scattered(rng, 200000);
+    std::vector<std::optional<MeshHit<3, float>>> random_single(random_rays.size()), random_packed(random_rays.size());
+    t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < random_rays.size(); ++i) random_single[i] = bvh.closest_hit(random_rays[i]);
+    t1 = std::chrono::steady_clock::now();
+    bvh.closest_hit(random_rays, random_packed);
+    t2 = std::chrono::steady_clock::now();
+    std::cout << "Random closest hit:  single " << rate(random_rays.size(), t1 - t0) << " Mrays/s, packets "
+              << rate(random_rays.size(), t2 - t1) << " Mrays/s\n";
+
+    std::cout << "\n[TEST] Packets agree with single rays: ";
+    bool ok = blocked_single == blocked_packed;
+    for (size_t i = 0; ok && i < n; ++i) ok = same_hit(single[i], packed[i]);
+    for (size_t i = 0; ok && i < random_rays.size(); ++i) ok = same_hit(random_single[i], random_packed[i]);
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    // Rays through mesh vertices and edge midpoints at shallow angles: hit
+    // or miss comes down to the last bit of u, v or det, so the two paths
+    // must round every product the same way. Two triangles meeting at the
+    // aimed point can hit within rounding of each other, and then either one
+    // may be reported.
+    std::cout << "[TEST] Grazing rays: same hits and occlusion, t within rounding: ";
+    std::vector<Ray<3, float>> grazing;
+    std::uniform_int_distribution<size_t> pick(0, mesh.size() - 1);
+    std::uniform_real_distribution<float> lift(-0.02f, 0.02f), along(-1, 1);
+    for (int k = 0; k < 20000; ++k) {
+        auto tri = mesh[pick(rng)];
+        P3 aim = k % 2 ? tri[0] : tri[0] + (tri[1] - tri[0]) * 0.5f;
+        V3 dir = (tri[2] - tri[0]) * along(rng) + (tri[1] - tri[0]) * along(rng) + V3{0, 0, lift(rng)};
+        grazing.emplace_back(aim - dir * 3.0f, dir);
+    }
+    std::vector<std::optional<MeshHit<3, float>>> grazing_single(grazing.size()), grazing_packed(grazing.size());
+    std::vector<uint8_t> grazing_blocked(grazing.size()), grazing_blocked_packed(grazing.size());
+    for (size_t i = 0; i < grazing.size(); ++i) {
+        grazing_single[i] = bvh.closest_hit(grazing[i]);
+        grazing_blocked[i] = bvh.occluded(grazing[i], 3.0f);
+    }
+    bvh.closest_hit(grazing, grazing_packed);
+    bvh.occluded(grazing, grazing_blocked_packed, 3.0f);
+    ok = grazing_blocked == grazing_blocked_packed;
+    for (size_t i = 0; ok && i < grazing.size(); ++i) ok = same_hit(grazing_single[i], grazing_packed[i]);
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] BVH agrees with testing every triangle: ";
+    auto small_ground = terrain(40, rng);
+    auto small_ball = sphere(P3{0, 0, 0.2f}, 0.5f, 12, 24);
+    auto small_rays = scattered(rng, 3000);
+    ok = true;
+    for (const auto* m : {&small_ground, &small_ball}) {
+        MeshBVH<3, float> small(*m);
+        for (const auto& r : small_rays) {
+            auto want = m->closest_hit(r), got = small.closest_hit(r);
+            ok = ok && same_hit(want, got) && small.occluded(r, 0.5f) == m->occluded(r, 0.5f);
+        }
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Barycentrics reproduce the hit point: ";
+    ok = true;
+    for (size_t i = 0; i < n; i += 97) {
+        if (!single[i]) continue;
+        auto [a, b, c] = mesh[single[i]->triangle];
+        float u = single[i]->u, v = single[i]->v;
+        P3 p = a + (b - a) * u + (c - a) * v, q = primary[i].at(single[i]->t);
+        ok = ok && u >= 0 && v >= 0 && u + v <= 1 && (p - q).squared_magnitude() < 1e-8f;
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Every ray from inside a closed sphere hits it: ";
+    MeshBVH<3, float> ball_bvh(small_ball);
+    std::vector<Ray<3, float>> inside;
+    for (const auto& r : scattered(rng, 10000)) inside.emplace_back(P3{0.05f, -0.02f, 0.23f}, r.direction);
+    std::vector<std::optional<MeshHit<3, float>>> inside_hits(inside.size());
+    ball_bvh.closest_hit(inside, inside_hits);
+    ok = true;
+    for (const auto& h : inside_hits) ok = ok && h && h->t > 0;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Bad index buffers are rejected: ";
+    int thrown = 0;
+    try { TriangleMesh<3, float>({P3{0, 0, 0}, P3{1, 0, 0}, P3{0, 1, 0}}, {0, 1}); } catch (const std::invalid_argument&) { ++thrown; }
+    try { TriangleMesh<3, float>({P3{0, 0, 0}, P3{1, 0, 0}, P3{0, 1, 0}}, {0, 1, 3}); } catch (const std::invalid_argument&) { ++thrown; }
+    std::cout << (thrown == 2 ? "PASS" : "FAIL") << "\n";
+    return 0;
+}
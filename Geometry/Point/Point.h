@@ -5,6 +5,7 @@
 #include <iostream>
 #include <type_traits>
 #include <stdexcept>
+#include <cassert>
 
 template <size_t D, typename Coord_t>
 class Vector;
@@ -18,33 +19,45 @@ class Point {
     std::array<Coord_t, D> coords;
 
 public:
-    Point() { coords.fill(0); }
-    explicit Point(std::initializer_list<Coord_t> lst);
+    constexpr Point() noexcept : coords{} {}
+    constexpr explicit Point(std::initializer_list<Coord_t> lst);
 
-    Coord_t& operator[](std::size_t i);
-    const Coord_t& operator[](std::size_t i) const;
+    // Checked access, throws std::out_of_range
+    constexpr Coord_t& operator[](std::size_t i);
+    constexpr const Coord_t& operator[](std::size_t i) const;
 
-    Point operator+(const Vector<D, Coord_t>& v) const;
-    Point operator-(const Vector<D, Coord_t>& v) const;
-    friend Point operator+(const Vector<D, Coord_t>& v, const Point& p) { return p + v; }
+    // Unchecked access for inner loops; asserts in debug builds only
+    constexpr Coord_t& get(std::size_t i) noexcept { assert(i < D); return coords[i]; }
+    constexpr const Coord_t& get(std::size_t i) const noexcept { assert(i < D); return coords[i]; }
 
-    friend Vector<D, Coord_t> operator-(const Point& a, const Point& b) {
+    constexpr Point operator+(const Vector<D, Coord_t>& v) const noexcept;
+    constexpr Point operator-(const Vector<D, Coord_t>& v) const noexcept;
+    friend constexpr Point operator+(const Vector<D, Coord_t>& v, const Point& p) noexcept { return p + v; }
+
+    friend constexpr Vector<D, Coord_t> operator-(const Point& a, const Point& b) noexcept {
         Vector<D, Coord_t> res;
         for (std::size_t i = 0; i < D; ++i)
-            res[i] = a[i] - b[i];
+            res.get(i) = a.coords[i] - b.coords[i];
         return res;
     }
 
-    bool operator==(const Point& other) const;
-    bool operator!=(const Point& other) const;
+    constexpr bool operator==(const Point& other) const noexcept;
+    constexpr bool operator!=(const Point& other) const noexcept;
 
-    Coord_t dx() const { return (D >= 1) ? coords[0] : throw std::out_of_range("dx() not available"); }
-    Coord_t dy() const { return (D >= 2) ? coords[1] : throw std::out_of_range("dy() not available"); }
-    void set_dx(Coord_t x) { if (D >= 1) coords[0] = x; else throw std::out_of_range("set_dx() not available"); }
-    void set_dy(Coord_t y) { if (D >= 2) coords[1] = y; else throw std::out_of_range("set_dy() not available"); }
-    void move(Coord_t dx, Coord_t dy) {
-        if (D >= 2) { coords[0] += dx; coords[1] += dy; }
-        else throw std::out_of_range("move() only for 2D");
+    constexpr Coord_t dx() const noexcept { return coords[0]; }
+    constexpr Coord_t dy() const noexcept {
+        static_assert(D >= 2, "dy() requires at least 2 dimensions");
+        return coords[1];
+    }
+    constexpr void set_dx(Coord_t x) noexcept { coords[0] = x; }
+    constexpr void set_dy(Coord_t y) noexcept {
+        static_assert(D >= 2, "set_dy() requires at least 2 dimensions");
+        coords[1] = y;
+    }
+    constexpr void move(Coord_t dx, Coord_t dy) noexcept {
+        static_assert(D == 2, "move() is only defined for 2-D points");
+        coords[0] += dx;
+        coords[1] += dy;
     }
 
     friend std::ostream& operator<<(std::ostream& os, const Point& p) {
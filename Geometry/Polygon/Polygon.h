@@ -5,23 +5,69 @@
 #include "../Vector/Vector_new.h"
 #include "../Ray/LineSegment.h"
 #include <vector>
+#include <cassert>
+#include <cstdint>
+#include <utility>
 #include <iostream>
 
+template <size_t D, typename T> class Affine;
+
 template <size_t D, typename T>
 class Polygon {
     static_assert(D == 2, "Polygon is 2D only for this version.");
     std::vector<Point<2, T>> vertices;
 
+    // Derived data, built with the vertices and kept current by set_vertex in
+    // O(1) per call, so const members only read it and a polygon can be
+    // shared across threads as soon as it is constructed. Sums are held in
+    // double and rebuilt from scratch once every n updates so rounding
+    // cannot drift.
+    struct Cache {
+        size_t updates = 0;
+        double sum[2] = {0, 0};            // vertex sums, which normals face
+        double moment[2] = {0, 0};         // first moments of area, times 6
+        double area2 = 0;                  // twice the signed area
+        size_t left = 0, right = 0;        // counts of left and right turns
+        Point<2, T> lo, hi;
+    };
+    Cache cache;
+
+    void rebuild();
+    void rebuild_box();
+    int8_t turn_at(size_t i) const;
+    void add_edge(size_t i, double sign);
+    Vector<2, T> perp_of(size_t i) const;
+
 public:
     Polygon() = default;
     explicit Polygon(std::initializer_list<Point<2, T>> pts);
+    explicit Polygon(std::vector<Point<2, T>> pts);
+
+    bool operator==(const Polygon& other) const;
+    bool operator!=(const Polygon& other) const;
 
     size_t size() const { return vertices.size(); }
     const Point<2, T>& operator[](size_t i) const;
-    Point<2, T>& operator[](size_t i);
+    // Unchecked access for hot loops; bounds are only asserted in debug builds
+    const Point<2, T>& get(size_t i) const noexcept {
+        assert(i < vertices.size());
+        return vertices[i];
+    }
+
+    // Vertices are only changed through these so the cache stays consistent
+    void set_vertex(size_t i, const Point<2, T>& p);
+    void move_vertex(size_t i, const Vector<2, T>& delta);
+    // Maps every vertex in place; see Transform/Affine.h
+    void transform(const Affine<2, T>& m);
 
     T area() const;
+    T signed_area() const;
+    int orientation() const;   // +1 counter-clockwise, -1 clockwise, 0 degenerate
+    // Centre of mass of the enclosed area; the vertex mean when the area is zero
+    Point<2, T> centroid() const;
+    std::pair<Point<2, T>, Point<2, T>> bounding_box() const;
     bool is_convex() const;
+    bool is_simple() const;
     bool isInside(const Point<2, T>& p) const;
 
     Vector<2, T> normal(size_t edge_index) const;
@@ -2,13 +2,27 @@
 #define POLYGON_IPP
 
 #include "Polygon.h"
+#include "PolygonOps.h"
+#include "../Sweep/SegmentIntersection.h"
 #include <cmath>
 #include <algorithm>
+#include <type_traits>
+#include <span>
 
 template <size_t D, typename T>
 Polygon<D, T>::Polygon(std::initializer_list<Point<2, T>> pts) : vertices(pts) {
     if (vertices.size() < 3)
         throw std::invalid_argument("Polygon must have at least 3 vertices");
+    rebuild();
+    rebuild_box();
+}
+
+template <size_t D, typename T>
+Polygon<D, T>::Polygon(std::vector<Point<2, T>> pts) : vertices(std::move(pts)) {
+    if (vertices.size() < 3)
+        throw std::invalid_argument("Polygon must have at least 3 vertices");
+    rebuild();
+    rebuild_box();
 }
 
 template <size_t D, typename T>
@@ -28,106 +42,215 @@ const Point<2, T>& Polygon<D, T>::operator[](size_t i) const {
 }
 
 template <size_t D, typename T>
-Point<2, T>& Polygon<D, T>::operator[](size_t i) {
-    if (i >= vertices.size()) throw std::out_of_range("Polygon index out of range");
-    return vertices[i];
+int8_t Polygon<D, T>::turn_at(size_t i) const {
+    const size_t n = vertices.size();
+    double o = orient2d(vertices[(i + n - 1) % n], vertices[i], vertices[(i + 1) % n]);
+    return o > 0 ? 1 : (o < 0 ? -1 : 0);
 }
 
 template <size_t D, typename T>
-T Polygon<D, T>::area() const {
-    if (vertices.size() < 3) return 0;
-    T sum = 0;
-    for (size_t i = 0; i < vertices.size(); ++i) {
-        size_t j = (i + 1) % vertices.size();
-        sum += vertices[i][0] * vertices[j][1] - vertices[j][0] * vertices[i][1];
+Vector<2, T> Polygon<D, T>::perp_of(size_t i) const {
+    Vector<2, T> edge = vertices[(i + 1) % vertices.size()] - vertices[i];
+    Vector<2, T> n{-edge.get(1), edge.get(0)};
+    if constexpr (std::is_floating_point_v<T>) {
+        if (n.squared_magnitude() != 0) n = n.normalized();
     }
-    return std::abs(sum) / 2;
+    return n;   // integral coordinates keep the unnormalized perpendicular
 }
 
+// Adds sign times edge i's share of the area and its first moments
 template <size_t D, typename T>
-bool Polygon<D, T>::is_convex() const {
-    if (vertices.size() < 3) return false;
-    T prev = 0;
-    for (size_t i = 0; i < vertices.size(); ++i) {
-        Vector<2, T> a = vertices[(i+1)%vertices.size()] - vertices[i];
-        Vector<2, T> b = vertices[(i+2)%vertices.size()] - vertices[(i+1)%vertices.size()];
-        T cross = a[0]*b[1] - a[1]*b[0];
-        if (cross != 0 && prev != 0 && cross * prev < 0) return false;
-        prev = cross;
-    }
-    return true;
+void Polygon<D, T>::add_edge(size_t i, double sign) {
+    const auto& a = vertices[i];
+    const auto& b = vertices[(i + 1) % vertices.size()];
+    double cross = sign * (double(a.dx()) * b.dy() - double(b.dx()) * a.dy());
+    cache.area2 += cross;
+    cache.moment[0] += (double(a.dx()) + b.dx()) * cross;
+    cache.moment[1] += (double(a.dy()) + b.dy()) * cross;
 }
 
 template <size_t D, typename T>
-bool Polygon<D, T>::isInside(const Point<2, T>& p) const {
-    bool inside = false;
-    for (size_t i = 0; i < vertices.size(); ++i) {
-        size_t j = (i + 1) % vertices.size();
-        if ((vertices[i][1] > p[1]) != (vertices[j][1] > p[1]) &&
-            (p[0] < vertices[i][0] + (vertices[j][0] - vertices[i][0]) *
-             (p[1] - vertices[i][1]) / (vertices[j][1] - vertices[i][1] + 1e-10))) {
-            inside = !inside;
-        }
+void Polygon<D, T>::rebuild() {
+    const size_t n = vertices.size();
+    Cache& c = cache;
+    c.sum[0] = c.sum[1] = 0;
+    c.moment[0] = c.moment[1] = 0;
+    c.area2 = 0;
+    c.left = c.right = 0;
+    for (size_t i = 0; i < n; ++i) {
+        c.sum[0] += vertices[i].dx();
+        c.sum[1] += vertices[i].dy();
+        add_edge(i, 1);
+        const int8_t turn = turn_at(i);
+        c.left += turn > 0;
+        c.right += turn < 0;
     }
-    return inside;
+    c.updates = 0;
 }
 
 template <size_t D, typename T>
-Vector<2, T> Polygon<D, T>::normal(size_t edge_index) const {
-    size_t i = edge_index % vertices.size();
-    size_t j = (i + 1) % vertices.size();
-    Vector<2, T> edge = vertices[j] - vertices[i];
-    Vector<2, T> n{-edge[1], edge[0]};
-
-    Point<2, T> centroid{0, 0};
+void Polygon<D, T>::rebuild_box() {
+    if (vertices.empty()) return;
+    cache.lo = cache.hi = vertices[0];
     for (const auto& v : vertices) {
-        centroid[0] += v[0];
-        centroid[1] += v[1];
+        cache.lo.set_dx(std::min(cache.lo.dx(), v.dx())); cache.hi.set_dx(std::max(cache.hi.dx(), v.dx()));
+        cache.lo.set_dy(std::min(cache.lo.dy(), v.dy())); cache.hi.set_dy(std::max(cache.hi.dy(), v.dy()));
     }
-    centroid[0] /= vertices.size();
-    centroid[1] /= vertices.size();
+}
 
-    Vector<2, T> to_centroid = centroid - vertices[i];
-    T dot = n[0] * to_centroid[0] + n[1] * to_centroid[1];
+template <size_t D, typename T>
+void Polygon<D, T>::set_vertex(size_t i, const Point<2, T>& p) {
+    const size_t n = vertices.size();
+    if (i >= n) throw std::out_of_range("Polygon index out of range");
+
+    Cache& c = cache;
+    const size_t h = (i + n - 1) % n, j = (i + 1) % n;
+    const Point<2, T> old = vertices[i];
+
+    // only the two edges at i and the turns at h, i, j see the move
+    add_edge(h, -1);
+    add_edge(i, -1);
+    // the old turns are recomputed rather than stored, which would cost
+    // every polygon a second allocation
+    for (size_t k : {h, i, j}) {
+        const int8_t turn = turn_at(k);
+        c.left -= turn > 0;
+        c.right -= turn < 0;
+    }
+    vertices[i] = p;
+    add_edge(h, 1);
+    add_edge(i, 1);
+    c.sum[0] += double(p.dx()) - old.dx();
+    c.sum[1] += double(p.dy()) - old.dy();
+    for (size_t k : {h, i, j}) {
+        const int8_t turn = turn_at(k);
+        c.left += turn > 0;
+        c.right += turn < 0;
+    }
 
-    if (dot < 0) {
-        n[0] = -n[0];
-        n[1] = -n[1];
+    // a vertex leaving the boundary inward may shrink the box, which takes a
+    // rescan; any other move only widens it
+    bool shrinks = (old.dx() == c.lo.dx() && p.dx() > c.lo.dx()) || (old.dx() == c.hi.dx() && p.dx() < c.hi.dx()) ||
+                   (old.dy() == c.lo.dy() && p.dy() > c.lo.dy()) || (old.dy() == c.hi.dy() && p.dy() < c.hi.dy());
+    if (shrinks) {
+        rebuild_box();
+    } else {
+        c.lo.set_dx(std::min(c.lo.dx(), p.dx())); c.hi.set_dx(std::max(c.hi.dx(), p.dx()));
+        c.lo.set_dy(std::min(c.lo.dy(), p.dy())); c.hi.set_dy(std::max(c.hi.dy(), p.dy()));
     }
 
-    return n.normalized();
+    if (++c.updates >= n) rebuild();
 }
 
 template <size_t D, typename T>
-bool Polygon<D, T>::intersect(const LineSegment<2, T>& seg, Point<2, T>* hit) const {
-    for (size_t i = 0; i < vertices.size(); ++i) {
-        size_t j = (i + 1) % vertices.size();
-        LineSegment<2, T> edge(vertices[i], vertices[j]);
-        auto opt = seg.intersect(edge);
-        if (opt) {
-            if (hit) *hit = *opt;
-            return true;
-        }
-    }
-    return false;
+void Polygon<D, T>::move_vertex(size_t i, const Vector<2, T>& delta) {
+    set_vertex(i, (*this)[i] + delta);
 }
 
 template <size_t D, typename T>
-bool Polygon<D, T>::intersect(const Polygon<2, T>& other) const {
-    for (size_t i = 0; i < vertices.size(); ++i) {
-        size_t j = (i + 1) % vertices.size();
-        LineSegment<2, T> e1(vertices[i], vertices[j]);
-        for (size_t k = 0; k < other.size(); ++k) {
-            size_t l = (k + 1) % other.size();
-            LineSegment<2, T> e2(other[k], other[l]);
-            if (e1.intersect(e2)) return true;
+T Polygon<D, T>::signed_area() const {
+    if (vertices.size() < 3) return 0;
+    return T(cache.area2 / 2);
+}
+
+template <size_t D, typename T>
+T Polygon<D, T>::area() const {
+    return std::abs(signed_area());
+}
+
+template <size_t D, typename T>
+int Polygon<D, T>::orientation() const {
+    // from the double sum, not signed_area(): halving in T can round an odd
+    // integer area2, or a tiny float one, to zero
+    if (vertices.size() < 3) return 0;
+    return cache.area2 > 0 ? 1 : (cache.area2 < 0 ? -1 : 0);
+}
+
+template <size_t D, typename T>
+Point<2, T> Polygon<D, T>::centroid() const {
+    if (vertices.empty()) throw std::logic_error("Polygon has no vertices");
+    // the area-weighted mean of the triangles (0, a, b) over every edge
+    if (cache.area2 == 0)
+        return Point<2, T>{T(cache.sum[0] / vertices.size()), T(cache.sum[1] / vertices.size())};
+    return Point<2, T>{T(cache.moment[0] / (3 * cache.area2)), T(cache.moment[1] / (3 * cache.area2))};
+}
+
+template <size_t D, typename T>
+std::pair<Point<2, T>, Point<2, T>> Polygon<D, T>::bounding_box() const {
+    if (vertices.empty()) throw std::logic_error("Polygon has no vertices");
+    return {cache.lo, cache.hi};
+}
+
+template <size_t D, typename T>
+void Polygon<D, T>::transform(const Affine<2, T>& m) {
+    if (vertices.empty()) return;
+    // the box comes out of the same pass
+    auto box = m.apply_bounds(std::span<Point<2, T>>(vertices));
+    cache.lo = box.first;
+    cache.hi = box.second;
+    rebuild();
+}
+
+template <size_t D, typename T>
+bool Polygon<D, T>::is_convex() const {
+    if (vertices.size() < 3) return false;
+    // collinear vertices are allowed; only a change of turn direction is not
+    return cache.left == 0 || cache.right == 0;
+}
+
+template <size_t D, typename T>
+bool Polygon<D, T>::is_simple() const {
+    const size_t n = vertices.size();
+    std::vector<LineSegment<2, T>> edges;
+    edges.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+        edges.emplace_back(vertices[i], vertices[(i + 1) % n]);
+
+    bool simple = true;
+    SegmentSweep<2, T> sweep(edges);
+    sweep.run([&](size_t i, size_t j, const Point<2, T>&) {
+        bool adjacent = (j == i + 1) || (i == 0 && j == n - 1);
+        if (adjacent) {
+            // neighbours share a vertex; they only overlap if they fold back
+            if (!edges[i].collinear(edges[j])) return false;
+            Vector<2, T> d1 = edges[i].b - edges[i].a;
+            Vector<2, T> d2 = edges[j].b - edges[j].a;
+            if (Vector<2, T>::dot_product(d1, d2) > 0) return false;
         }
-    }
-    if (isInside(other[0])) return true;
-    if (other.isInside(vertices[0])) return true;
-    return false;
+        simple = false;
+        return true;
+    });
+    return simple;
+}
+
+template <size_t D, typename T>
+bool Polygon<D, T>::isInside(const Point<2, T>& p) const {
+    return polygon_contains(*this, p);
+}
+
+template <size_t D, typename T>
+Vector<2, T> Polygon<D, T>::normal(size_t edge_index) const {
+    static_assert(std::is_floating_point_v<T>, "Unit normals need floating-point coordinates");
+    if (vertices.empty()) throw std::logic_error("Polygon has no vertices");
+    size_t i = edge_index % vertices.size();
+    Vector<2, T> n = perp_of(i);
+    if (n.squared_magnitude() == 0) throw std::runtime_error("Cannot normalize zero vector");
+
+    // face the vertex mean
+    Point<2, T> mean{T(cache.sum[0] / vertices.size()), T(cache.sum[1] / vertices.size())};
+    Vector<2, T> to_mean = mean - vertices[i];
+    if (Vector<2, T>::dot_product(n, to_mean) < 0) n = n * T(-1);
+    return n;
 }
 
-template class Polygon<2, float>;
+template <size_t D, typename T>
+bool Polygon<D, T>::intersect(const LineSegment<2, T>& seg, Point<2, T>* hit) const {
+    return polygon_intersect(*this, seg, hit);
+}
+
+template <size_t D, typename T>
+bool Polygon<D, T>::intersect(const Polygon<2, T>& other) const {
+    return polygon_intersect(*this, other);
+}
 
 #endif // POLYGON_IPP
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef POLYGON_OPS_H
+#define POLYGON_OPS_H
+
+#include "../Point/Point.h"
+#include "../Vector/Vector_new.h"
+#include "../Ray/LineSegment.h"
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+template <size_t D, typename T> class Ray;
+
+// Polygon algorithms written once for anything polygon-like: a type with
+// size() and operator[](i) yielding a Point<2, T> (by reference or value),
+// e.g. Polygon, PolygonView or a std::array of Points. Types that also have
+// an unchecked get(i) are read through it. polygon_area is constexpr, so
+// fixed shapes can be measured at compile time.
+
+template <typename Poly>
+using polygon_coord_t = std::remove_cvref_t<decltype(std::declval<const Poly&>()[0][0])>;
+
+// Vertex i through get(i) when the type has it, else operator[]
+template <typename Poly>
+constexpr decltype(auto) polygon_vertex(const Poly& poly, size_t i);
+
+template <typename Poly>
+constexpr polygon_coord_t<Poly> polygon_area(const Poly& poly);
+
+template <typename Poly, typename T>
+bool polygon_contains(const Poly& poly, const Point<2, T>& p);
+
+template <typename Poly, typename T>
+bool polygon_intersect(const Poly& poly, const LineSegment<2, T>& seg, Point<2, T>* hit = nullptr);
+
+template <typename PolyA, typename PolyB>
+bool polygon_intersect(const PolyA& a, const PolyB& b);
+
+// Smallest t >= 0 at which the ray meets the boundary
+template <typename Poly, typename T>
+std::optional<T> polygon_ray_cast(const Ray<2, T>& ray, const Poly& poly);
+
+#include "PolygonOps.ipp"
+
+#endif // POLYGON_OPS_H
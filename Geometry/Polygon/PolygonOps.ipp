@@ -0,0 +1,126 @@
+#ifndef POLYGON_OPS_IPP
+#define POLYGON_OPS_IPP
+
+#include "PolygonOps.h"
+#include "../Sweep/SegmentIntersection.h"
+#include "../Stats/Stats.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+template <typename Poly>
+constexpr decltype(auto) polygon_vertex(const Poly& poly, size_t i) {
+    if constexpr (requires { poly.get(i); }) return poly.get(i);
+    else return poly[i];
+}
+
+template <typename Poly>
+constexpr polygon_coord_t<Poly> polygon_area(const Poly& poly) {
+    using T = polygon_coord_t<Poly>;
+    const size_t n = poly.size();
+    if (n < 3) return 0;
+    double sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+        Point<2, T> a = polygon_vertex(poly, i), b = polygon_vertex(poly, i + 1 < n ? i + 1 : 0);
+        sum += double(a.dx()) * b.dy() - double(b.dx()) * a.dy();
+    }
+    return static_cast<T>((sum < 0 ? -sum : sum) / 2);
+}
+
+template <typename Poly, typename T>
+bool polygon_contains(const Poly& poly, const Point<2, T>& p) {
+    COMPGEO_TIME(PolygonContains);
+    const size_t n = poly.size();
+    COMPGEO_COUNT_N(EdgesTested, n);
+    bool inside = false;
+    for (size_t i = 0; i < n; ++i) {
+        Point<2, T> a = polygon_vertex(poly, i), b = polygon_vertex(poly, i + 1 < n ? i + 1 : 0);
+        if ((a.dy() > p.dy()) != (b.dy() > p.dy())) {
+            // p lies left of the crossing iff it is on the left of an upward edge
+            double side = orient2d(a, b, p);
+            if (b.dy() > a.dy() ? side > 0 : side < 0) inside = !inside;
+        }
+    }
+    return inside;
+}
+
+template <typename Poly, typename T>
+bool polygon_intersect(const Poly& poly, const LineSegment<2, T>& seg, Point<2, T>* hit) {
+    COMPGEO_TIME(PolygonIntersectSegment);
+    const size_t n = poly.size();
+    for (size_t i = 0; i < n; ++i) {
+        LineSegment<2, T> edge(polygon_vertex(poly, i), polygon_vertex(poly, i + 1 < n ? i + 1 : 0));
+        auto opt = seg.intersect(edge);
+        if (opt) {
+            if (hit) *hit = *opt;
+            COMPGEO_COUNT_N(EdgesTested, i + 1);
+            COMPGEO_COUNT(EarlyExits);
+            return true;
+        }
+    }
+    COMPGEO_COUNT_N(EdgesTested, n);
+    return false;
+}
+
+template <typename PolyA, typename PolyB>
+bool polygon_intersect(const PolyA& a, const PolyB& b) {
+    COMPGEO_TIME(PolygonIntersectPolygon);
+    using T = polygon_coord_t<PolyA>;
+    const size_t n = a.size(), m = b.size();
+    if (n * m > 1024) {
+        // large inputs: sweep both edge sets and stop at the first cross pair
+        std::vector<LineSegment<2, T>> edges;
+        edges.reserve(n + m);
+        for (size_t i = 0; i < n; ++i) edges.emplace_back(polygon_vertex(a, i), polygon_vertex(a, (i + 1) % n));
+        for (size_t k = 0; k < m; ++k) edges.emplace_back(polygon_vertex(b, k), polygon_vertex(b, (k + 1) % m));
+
+        bool crossed = false;
+        SegmentSweep<2, T> sweep(edges);
+        sweep.run([&](size_t i, size_t j, const Point<2, T>&) {
+            if (i >= n || j < n) return false;
+            crossed = !edges[i].collinear(edges[j]);
+            return crossed;
+        });
+        // the sweep sees each edge once rather than each pair
+        COMPGEO_COUNT_N(EdgesTested, n + m);
+        if (crossed) {
+            COMPGEO_COUNT(EarlyExits);
+            return true;
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            LineSegment<2, T> e1(polygon_vertex(a, i), polygon_vertex(a, (i + 1) % n));
+            for (size_t k = 0; k < m; ++k) {
+                LineSegment<2, T> e2(polygon_vertex(b, k), polygon_vertex(b, (k + 1) % m));
+                if (e1.intersect(e2)) {
+                    COMPGEO_COUNT_N(EdgesTested, i * m + k + 1);
+                    COMPGEO_COUNT(EarlyExits);
+                    return true;
+                }
+            }
+        }
+        COMPGEO_COUNT_N(EdgesTested, n * m);
+    }
+    if (n == 0 || m == 0) return false;
+    return polygon_contains(a, Point<2, T>(polygon_vertex(b, 0))) ||
+           polygon_contains(b, Point<2, T>(polygon_vertex(a, 0)));
+}
+
+template <typename Poly, typename T>
+std::optional<T> polygon_ray_cast(const Ray<2, T>& ray, const Poly& poly) {
+    const size_t n = poly.size();
+    COMPGEO_COUNT_N(EdgesTested, n);
+    T t_min = std::numeric_limits<T>::max();
+    bool hit = false;
+    for (size_t i = 0; i < n; ++i) {
+        LineSegment<2, T> edge(polygon_vertex(poly, i), polygon_vertex(poly, i + 1 < n ? i + 1 : 0));
+        auto opt = ray.intersect(edge);
+        if (opt && *opt >= 0) {
+            if (*opt < t_min) t_min = *opt;
+            hit = true;
+        }
+    }
+    return hit ? std::optional<T>(t_min) : std::nullopt;
+}
+
+#endif // POLYGON_OPS_IPP
@@ -0,0 +1,59 @@
+#ifndef POLYGON_VIEW_H
+#define POLYGON_VIEW_H
+
+#include "../Point/Point.h"
+#include "../Ray/LineSegment.h"
+#include "PolygonOps.h"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+template <size_t D, typename T> class Polygon;
+
+// Non-owning polygon over `n` interleaved (x, y) pairs in memory someone else
+// owns, e.g. a mapped GeometryFile. Vertices are returned by value, so the
+// coordinates are never copied into Points up front. The view must not
+// outlive the storage.
+template <size_t D, typename T>
+class PolygonView {
+    static_assert(D == 2, "PolygonView is 2D only for this version.");
+
+    const T* xy = nullptr;
+    size_t count = 0;
+
+public:
+    PolygonView() = default;
+    PolygonView(const T* coords, size_t n) : xy(coords), count(n) {}
+
+    size_t size() const { return count; }
+    const T* data() const { return xy; }
+
+    Point<2, T> operator[](size_t i) const {
+        if (i >= count) throw std::out_of_range("PolygonView index out of range");
+        return Point<2, T>{xy[2 * i], xy[2 * i + 1]};
+    }
+    Point<2, T> get(size_t i) const noexcept {
+        assert(i < count);
+        return Point<2, T>{xy[2 * i], xy[2 * i + 1]};
+    }
+
+    T area() const { return polygon_area(*this); }
+    bool isInside(const Point<2, T>& p) const { return polygon_contains(*this, p); }
+    bool intersect(const LineSegment<2, T>& seg, Point<2, T>* hit = nullptr) const {
+        return polygon_intersect(*this, seg, hit);
+    }
+    bool intersect(const PolygonView& other) const { return polygon_intersect(*this, other); }
+    bool intersect(const Polygon<2, T>& other) const { return polygon_intersect(*this, other); }
+
+    friend std::ostream& operator<<(std::ostream& os, const PolygonView& poly) {
+        os << "Polygon[";
+        for (size_t i = 0; i < poly.size(); ++i) {
+            os << poly[i];
+            if (i + 1 < poly.size()) os << ", ";
+        }
+        os << "]";
+        return os;
+    }
+};
+
+#endif // POLYGON_VIEW_H
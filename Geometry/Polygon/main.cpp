@@ -1,6 +1,21 @@
 #include "Polygon.h"
 #include "../Ray/LineSegment.h"
 #include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <array>
+
+// Evaluated entirely by the compiler
+constexpr std::array<Point<2, double>, 4> unit_square{
+    Point<2, double>{0, 0}, Point<2, double>{1, 0}, Point<2, double>{1, 1}, Point<2, double>{0, 1}};
+static_assert(polygon_area(unit_square) == 1.0, "unit square area");
+
+constexpr Point<2, int> translated(Point<2, int> p, Vector<2, int> by) { return p + by; }
+static_assert(translated(Point<2, int>{1, 2}, Vector<2, int>{3, -4}) == Point<2, int>{4, -2});
+static_assert(Vector<2, int>::dot_product(Vector<2, int>{2, 3}, Vector<2, int>{4, -1}) == 5);
+static_assert(Vector<2, int>{1, 0}.cross_2d(Vector<2, int>{0, 1}) == 1);
+static_assert(noexcept(Point<2, float>{} + Vector<2, float>{}), "point arithmetic does not throw");
 
 int main() {
     Polygon<2, float> tri({
@@ -33,5 +48,113 @@ int main() {
 
     std::cout << "Tri ∩ Quad: " << (tri.intersect(quad) ? "YES" : "NO") << "\n";
 
+    std::cout << "\n=== CACHED DERIVED DATA ===\n\n";
+
+    // Reference values computed straight from the vertices
+    auto scan = [](const Polygon<2, float>& p, double& area2, double& cx, double& cy) {
+        area2 = cx = cy = 0;
+        for (size_t i = 0; i < p.size(); ++i) {
+            const auto& a = p[i];
+            const auto& b = p[(i + 1) % p.size()];
+            double cross = double(a[0]) * b[1] - double(b[0]) * a[1];
+            area2 += cross;
+            cx += (double(a[0]) + b[0]) * cross;
+            cy += (double(a[1]) + b[1]) * cross;
+        }
+        cx /= 3 * area2;
+        cy /= 3 * area2;
+    };
+
+    const size_t n = 20000;
+    std::vector<Point<2, float>> ring;
+    for (size_t k = 0; k < n; ++k) {
+        float a = 2 * float(M_PI) * k / n;
+        ring.push_back(Point<2, float>{100 * std::cos(a), 100 * std::sin(a)});
+    }
+    Polygon<2, float> big(ring);
+
+    auto t0 = std::chrono::steady_clock::now();
+    float sink = 0;
+    for (size_t i = 0; i < n; ++i) sink += big.normal(i)[0];
+    auto t1 = std::chrono::steady_clock::now();
+    std::cout << "All " << n << " normals: "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms"
+              << (sink == 0.125f ? " " : "") << "\n";
+
+    // Jiggle a few vertices per tick; the cache must track a full rescan
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    std::uniform_real_distribution<float> step(-0.01f, 0.01f);
+    t0 = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < 10000; ++tick) {
+        for (int k = 0; k < 4; ++k)
+            big.move_vertex(pick(rng), Vector<2, float>{step(rng), step(rng)});
+        sink += big.area() + big.centroid()[0] + (big.is_convex() ? 1 : 0);
+    }
+    t1 = std::chrono::steady_clock::now();
+    std::cout << "10000 ticks of 4 moves + area/centroid/convexity: "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms\n";
+
+    std::cout << "[TEST] Area and centroid track vertex moves: ";
+    double area2, cx, cy;
+    scan(big, area2, cx, cy);
+    auto c = big.centroid();
+    bool ok = std::abs(big.signed_area() - area2 / 2) < 1e-3 * std::abs(area2) &&
+              std::abs(c[0] - cx) < 1e-3 && std::abs(c[1] - cy) < 1e-3 && big.orientation() == 1;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Convexity follows a dent and its repair: ";
+    Polygon<2, float> sq({
+        Point<2, float>{0, 0}, Point<2, float>{2, 0}, Point<2, float>{2, 1},
+        Point<2, float>{2, 2}, Point<2, float>{0, 2}
+    });
+    ok = sq.is_convex();
+    sq.set_vertex(2, Point<2, float>{1, 1});
+    ok = ok && !sq.is_convex();
+    sq.set_vertex(2, Point<2, float>{2, 1});
+    ok = ok && sq.is_convex();
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    // The extra vertex on the right side pulls the vertex mean to x = 1.2
+    std::cout << "[TEST] Centroid is the centre of area: ";
+    ok = sq.centroid() == Point<2, float>{1, 1};
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Bounding box shrinks when an extreme vertex moves in: ";
+    sq.set_vertex(1, Point<2, float>{5, -1});
+    auto box = sq.bounding_box();
+    ok = box.first == Point<2, float>{0, -1} && box.second == Point<2, float>{5, 2};
+    sq.set_vertex(1, Point<2, float>{2, 0});
+    box = sq.bounding_box();
+    ok = ok && box.first == Point<2, float>{0, 0} && box.second == Point<2, float>{2, 2};
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Cached normals point inward: ";
+    ok = true;
+    for (size_t i = 0; i < big.size(); i += 97) {
+        Vector<2, float> to_centre = Point<2, float>{0, 0} - big[i];
+        ok = ok && Vector<2, float>::dot_product(big.normal(i), to_centre) > 0;
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Integer and double polygons: ";
+    Polygon<2, int> grid({Point<2, int>{0, 0}, Point<2, int>{4, 0}, Point<2, int>{4, 3}, Point<2, int>{0, 3}});
+    Polygon<2, double> fine({Point<2, double>{0, 0}, Point<2, double>{0.5, 0}, Point<2, double>{0, 0.5}});
+    ok = grid.area() == 12 && grid.orientation() == 1 && grid.isInside(Point<2, int>{2, 1}) &&
+         !grid.isInside(Point<2, int>{5, 1}) && grid.is_convex() &&
+         fine.area() == 0.125 && fine.isInside(Point<2, double>{0.1, 0.1});
+    grid.set_vertex(2, Point<2, int>{8, 3});
+    ok = ok && grid.area() == 18 && grid.bounding_box().second == Point<2, int>{8, 3};
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    // twice the area is 1, so the area itself truncates to 0 in int; the
+    // orientation must still see the turn
+    std::cout << "[TEST] Odd doubled area keeps its orientation: ";
+    Polygon<2, int> unit_ccw({Point<2, int>{0, 0}, Point<2, int>{1, 0}, Point<2, int>{0, 1}});
+    Polygon<2, int> unit_cw({Point<2, int>{0, 0}, Point<2, int>{0, 1}, Point<2, int>{1, 0}});
+    Polygon<2, float> speck({Point<2, float>{0, 0}, Point<2, float>{1e-30f, 0}, Point<2, float>{0, 1e-30f}});
+    ok = unit_ccw.orientation() == 1 && unit_cw.orientation() == -1 && speck.orientation() == 1;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
     return 0;
 }
\ No newline at end of file
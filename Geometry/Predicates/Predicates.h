@@ -0,0 +1,38 @@
+#ifndef PREDICATES_H
+#define PREDICATES_H
+
+#include "../Point/Point.h"
+
+// Robust geometric predicates after Shewchuk. Each predicate first evaluates
+// the determinant in plain double arithmetic together with a forward error
+// bound; only when the bound cannot certify the sign does it fall back to
+// exact expansion arithmetic. The sign of the result is always exact.
+//
+//   orient2d(a, b, c)     > 0 if a, b, c turn counterclockwise, < 0 if clockwise
+//   orient3d(a, b, c, d)  > 0 if d lies below the plane through a, b, c
+//                         (a, b, c counterclockwise seen from above)
+//   incircle(a, b, c, d)  > 0 if d lies inside the circle through a, b, c
+//                         (a, b, c counterclockwise)
+
+inline double orient2d(const double* pa, const double* pb, const double* pc);
+inline double orient3d(const double* pa, const double* pb, const double* pc, const double* pd);
+inline double incircle(const double* pa, const double* pb, const double* pc, const double* pd);
+
+// The floating-point filters alone: store the plain determinant in `det` and
+// return true when its sign is certified, false when the exact path is needed.
+inline bool orient2d_filter(const double* pa, const double* pb, const double* pc, double& det);
+inline bool orient3d_filter(const double* pa, const double* pb, const double* pc, const double* pd, double& det);
+inline bool incircle_filter(const double* pa, const double* pb, const double* pc, const double* pd, double& det);
+
+template <typename T>
+double orient2d(const Point<2, T>& a, const Point<2, T>& b, const Point<2, T>& c);
+
+template <typename T>
+double orient3d(const Point<3, T>& a, const Point<3, T>& b, const Point<3, T>& c, const Point<3, T>& d);
+
+template <typename T>
+double incircle(const Point<2, T>& a, const Point<2, T>& b, const Point<2, T>& c, const Point<2, T>& d);
+
+#include "Predicates.ipp"
+
+#endif // PREDICATES_H
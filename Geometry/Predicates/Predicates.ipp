@@ -0,0 +1,244 @@
+#ifndef PREDICATES_IPP
+#define PREDICATES_IPP
+
+#include "Predicates.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <cassert>
+
+// Nonoverlapping floating-point expansion of at most N components, in
+// increasing order of magnitude with zeros removed, held on the stack. Its
+// exact value is the sum of its components, and the sign of the sum is the
+// sign of the last component. Each operation's result type has room for the
+// worst case, so the determinants below never allocate.
+template <size_t N>
+class Expansion {
+    template <size_t> friend class Expansion;
+
+    double terms[N];
+    size_t count = 0;
+
+    static void two_sum(double a, double b, double& x, double& y) {
+        x = a + b;
+        double bv = x - a, av = x - bv;
+        y = (a - av) + (b - bv);
+    }
+    static void fast_two_sum(double a, double b, double& x, double& y) {
+        x = a + b;
+        y = b - (x - a);
+    }
+    static void two_product(double a, double b, double& x, double& y) {
+        x = a * b;
+        y = std::fma(a, b, -x);
+    }
+
+    // terms + b in place (Shewchuk's GROW-EXPANSION with zero elimination);
+    // component h is written only after component h has been read
+    void grow(double b) {
+        assert(count < N);
+        double q = b, sum, err;
+        size_t h = 0;
+        for (size_t i = 0; i < count; ++i) {
+            two_sum(q, terms[i], sum, err);
+            if (err != 0) terms[h++] = err;
+            q = sum;
+        }
+        if (q != 0 || h == 0) terms[h++] = q;
+        count = h;
+    }
+
+    template <size_t M>
+    void accumulate(const Expansion<M>& o, double sign) {
+        for (size_t i = 0; i < o.count; ++i) grow(sign * o.terms[i]);
+    }
+
+public:
+    // exact a - b
+    static Expansion diff(double a, double b) {
+        static_assert(N >= 2, "a difference needs two components");
+        Expansion r;
+        double x = a - b;
+        double bv = a - x, av = x + bv;
+        double y = (a - av) + (bv - b);
+        if (y != 0) r.terms[r.count++] = y;
+        r.terms[r.count++] = x;
+        return r;
+    }
+
+    template <size_t M>
+    Expansion<N + M> operator+(const Expansion<M>& o) const {
+        Expansion<N + M> r;
+        std::copy(terms, terms + count, r.terms);
+        r.count = count;
+        r.accumulate(o, 1);
+        return r;
+    }
+
+    template <size_t M>
+    Expansion<N + M> operator-(const Expansion<M>& o) const {
+        Expansion<N + M> r;
+        std::copy(terms, terms + count, r.terms);
+        r.count = count;
+        r.accumulate(o, -1);
+        return r;
+    }
+
+    // Shewchuk's SCALE-EXPANSION with zero elimination
+    Expansion<2 * N> operator*(double b) const {
+        Expansion<2 * N> r;
+        if (count == 0) return r;
+        double q, hh, p1, p0, sum;
+        two_product(terms[0], b, q, hh);
+        if (hh != 0) r.terms[r.count++] = hh;
+        for (size_t i = 1; i < count; ++i) {
+            two_product(terms[i], b, p1, p0);
+            two_sum(q, p0, sum, hh);
+            if (hh != 0) r.terms[r.count++] = hh;
+            fast_two_sum(p1, sum, q, hh);
+            if (hh != 0) r.terms[r.count++] = hh;
+        }
+        if (q != 0 || r.count == 0) r.terms[r.count++] = q;
+        return r;
+    }
+
+    template <size_t M>
+    Expansion<2 * N * M> operator*(const Expansion<M>& o) const {
+        Expansion<2 * N * M> r;
+        for (size_t i = 0; i < o.count; ++i) r.accumulate(*this * o.terms[i], 1);
+        return r;
+    }
+
+    // most significant component: carries the exact sign
+    double approx() const { return count == 0 ? 0 : terms[count - 1]; }
+};
+
+using Expansion2 = Expansion<2>;
+
+// Shewchuk's stage-A error bounds; epsilon is half an ulp of 1
+inline constexpr double predicate_epsilon = std::numeric_limits<double>::epsilon() / 2;
+inline constexpr double ccw_errbound = (3.0 + 16.0 * predicate_epsilon) * predicate_epsilon;
+inline constexpr double o3d_errbound = (7.0 + 56.0 * predicate_epsilon) * predicate_epsilon;
+inline constexpr double icc_errbound = (10.0 + 96.0 * predicate_epsilon) * predicate_epsilon;
+
+inline bool orient2d_filter(const double* pa, const double* pb, const double* pc, double& det) {
+    double detleft = (pa[0] - pc[0]) * (pb[1] - pc[1]);
+    double detright = (pa[1] - pc[1]) * (pb[0] - pc[0]);
+    det = detleft - detright;
+    // Shewchuk branches on the signs of the two products; when they differ
+    // |det| is their summed magnitude and passes this test anyway, so one
+    // comparison covers every case without data-dependent branches
+    return std::abs(det) >= ccw_errbound * (std::abs(detleft) + std::abs(detright));
+}
+
+// The exact fallbacks stay out of line, so the filtered path inlines into
+// callers as a few multiplies and a compare
+[[gnu::noinline]] inline double orient2d_exact(const double* pa, const double* pb, const double* pc) {
+    Expansion2 acx = Expansion2::diff(pa[0], pc[0]), bcx = Expansion2::diff(pb[0], pc[0]);
+    Expansion2 acy = Expansion2::diff(pa[1], pc[1]), bcy = Expansion2::diff(pb[1], pc[1]);
+    return (acx * bcy - acy * bcx).approx();
+}
+
+inline double orient2d(const double* pa, const double* pb, const double* pc) {
+    double det;
+    if (orient2d_filter(pa, pb, pc, det)) [[likely]] return det;
+    return orient2d_exact(pa, pb, pc);
+}
+
+inline bool orient3d_filter(const double* pa, const double* pb, const double* pc, const double* pd, double& det) {
+    double adx = pa[0] - pd[0], bdx = pb[0] - pd[0], cdx = pc[0] - pd[0];
+    double ady = pa[1] - pd[1], bdy = pb[1] - pd[1], cdy = pc[1] - pd[1];
+    double adz = pa[2] - pd[2], bdz = pb[2] - pd[2], cdz = pc[2] - pd[2];
+
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady, adxcdy = adx * cdy;
+    double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+    double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * std::abs(adz)
+                     + (std::abs(cdxady) + std::abs(adxcdy)) * std::abs(bdz)
+                     + (std::abs(adxbdy) + std::abs(bdxady)) * std::abs(cdz);
+    double errbound = o3d_errbound * permanent;
+    return det > errbound || -det > errbound;
+}
+
+[[gnu::noinline]] inline double orient3d_exact(const double* pa, const double* pb, const double* pc, const double* pd) {
+    Expansion2 adx = Expansion2::diff(pa[0], pd[0]), bdx = Expansion2::diff(pb[0], pd[0]), cdx = Expansion2::diff(pc[0], pd[0]);
+    Expansion2 ady = Expansion2::diff(pa[1], pd[1]), bdy = Expansion2::diff(pb[1], pd[1]), cdy = Expansion2::diff(pc[1], pd[1]);
+    Expansion2 adz = Expansion2::diff(pa[2], pd[2]), bdz = Expansion2::diff(pb[2], pd[2]), cdz = Expansion2::diff(pc[2], pd[2]);
+
+    auto a = adz * (bdx * cdy - cdx * bdy);
+    auto b = bdz * (cdx * ady - adx * cdy);
+    auto c = cdz * (adx * bdy - bdx * ady);
+    return (a + b + c).approx();
+}
+
+inline double orient3d(const double* pa, const double* pb, const double* pc, const double* pd) {
+    double det;
+    if (orient3d_filter(pa, pb, pc, pd, det)) [[likely]] return det;
+    return orient3d_exact(pa, pb, pc, pd);
+}
+
+inline bool incircle_filter(const double* pa, const double* pb, const double* pc, const double* pd, double& det) {
+    double adx = pa[0] - pd[0], bdx = pb[0] - pd[0], cdx = pc[0] - pd[0];
+    double ady = pa[1] - pd[1], bdy = pb[1] - pd[1], cdy = pc[1] - pd[1];
+
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy, alift = adx * adx + ady * ady;
+    double cdxady = cdx * ady, adxcdy = adx * cdy, blift = bdx * bdx + bdy * bdy;
+    double adxbdy = adx * bdy, bdxady = bdx * ady, clift = cdx * cdx + cdy * cdy;
+
+    det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+    double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift
+                     + (std::abs(cdxady) + std::abs(adxcdy)) * blift
+                     + (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+    double errbound = icc_errbound * permanent;
+    return det > errbound || -det > errbound;
+}
+
+[[gnu::noinline]] inline double incircle_exact(const double* pa, const double* pb, const double* pc, const double* pd) {
+    Expansion2 adx = Expansion2::diff(pa[0], pd[0]), bdx = Expansion2::diff(pb[0], pd[0]), cdx = Expansion2::diff(pc[0], pd[0]);
+    Expansion2 ady = Expansion2::diff(pa[1], pd[1]), bdy = Expansion2::diff(pb[1], pd[1]), cdy = Expansion2::diff(pc[1], pd[1]);
+
+    auto alift = adx * adx + ady * ady;
+    auto blift = bdx * bdx + bdy * bdy;
+    auto clift = cdx * cdx + cdy * cdy;
+
+    auto a = alift * (bdx * cdy - cdx * bdy);
+    auto b = blift * (cdx * ady - adx * cdy);
+    auto c = clift * (adx * bdy - bdx * ady);
+    return (a + b + c).approx();
+}
+
+inline double incircle(const double* pa, const double* pb, const double* pc, const double* pd) {
+    double det;
+    if (incircle_filter(pa, pb, pc, pd, det)) [[likely]] return det;
+    return incircle_exact(pa, pb, pc, pd);
+}
+
+template <typename T>
+double orient2d(const Point<2, T>& a, const Point<2, T>& b, const Point<2, T>& c) {
+    const double pa[2] = { double(a.dx()), double(a.dy()) };
+    const double pb[2] = { double(b.dx()), double(b.dy()) };
+    const double pc[2] = { double(c.dx()), double(c.dy()) };
+    return orient2d(pa, pb, pc);
+}
+
+template <typename T>
+double orient3d(const Point<3, T>& a, const Point<3, T>& b, const Point<3, T>& c, const Point<3, T>& d) {
+    const double pa[3] = { double(a[0]), double(a[1]), double(a[2]) };
+    const double pb[3] = { double(b[0]), double(b[1]), double(b[2]) };
+    const double pc[3] = { double(c[0]), double(c[1]), double(c[2]) };
+    const double pd[3] = { double(d[0]), double(d[1]), double(d[2]) };
+    return orient3d(pa, pb, pc, pd);
+}
+
+template <typename T>
+double incircle(const Point<2, T>& a, const Point<2, T>& b, const Point<2, T>& c, const Point<2, T>& d) {
+    const double pa[2] = { double(a.dx()), double(a.dy()) };
+    const double pb[2] = { double(b.dx()), double(b.dy()) };
+    const double pc[2] = { double(c.dx()), double(c.dy()) };
+    const double pd[2] = { double(d.dx()), double(d.dy()) };
+    return incircle(pa, pb, pc, pd);
+}
+
+#endif // PREDICATES_IPP
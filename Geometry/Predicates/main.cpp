@@ -0,0 +1,111 @@
+#include "Predicates.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <vector>
+#include <array>
+
+using P2 = std::array<double, 2>;
+using P3 = std::array<double, 3>;
+
+static double naive_orient2d(const P2& a, const P2& b, const P2& c) {
+    return (a[0] - c[0]) * (b[1] - c[1]) - (a[1] - c[1]) * (b[0] - c[0]);
+}
+
+static const char* sign(double v) { return v > 0 ? "+" : (v < 0 ? "-" : "0"); }
+
+int main() {
+    // Classic failure: c is a hair off the line a-b, far from the origin
+    P2 a{12, 12}, b{24, 24}, c{std::nextafter(0.5, 1.0), 0.5};
+    std::cout << "Near-collinear orient2d  naive: " << sign(naive_orient2d(a, b, c))
+              << ", robust: " << sign(orient2d(a.data(), b.data(), c.data())) << "\n";
+
+    Point<2, float> fa{0, 0}, fb{1e7f, 1e7f}, fc{3e7f, 3e7f};
+    std::cout << "Collinear float points:  " << sign(orient2d(fa, fb, fc)) << "\n";
+
+    Point<2, double> q0{0, 0}, q1{1, 0}, q2{0, 1};
+    std::cout << "incircle((0.5,0.5)): " << sign(incircle(q0, q1, q2, Point<2, double>{0.5, 0.5}))
+              << ", incircle((1,1)): " << sign(incircle(q0, q1, q2, Point<2, double>{1, 1}))
+              << ", incircle((2,2)): " << sign(incircle(q0, q1, q2, Point<2, double>{2, 2})) << "\n";
+
+    Point<3, double> r0{0, 0, 0}, r1{1, 0, 0}, r2{0, 1, 0};
+    std::cout << "orient3d below/on/above: "
+              << sign(orient3d(r0, r1, r2, Point<3, double>{0, 0, -1})) << " "
+              << sign(orient3d(r0, r1, r2, Point<3, double>{5, 5, 0})) << " "
+              << sign(orient3d(r0, r1, r2, Point<3, double>{0, 0, 1})) << "\n";
+
+    std::cout << "\n=== FILTER HIT RATES ===\n\n";
+
+    const size_t n = 1000000;
+    std::mt19937_64 rng(3);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0), unit(0.0, 1.0);
+
+    // random: general position; near: c on the segment a-b up to rounding;
+    // grid: small integers, many exact degeneracies
+    std::vector<P2> rnd(3 * n), near(3 * n), grid(3 * n);
+    std::uniform_int_distribution<int> small(0, 4);
+    for (size_t i = 0; i < n; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            rnd[3 * i + k] = {coord(rng), coord(rng)};
+            grid[3 * i + k] = {double(small(rng)), double(small(rng))};
+        }
+        P2 p{coord(rng), coord(rng)}, q{coord(rng), coord(rng)};
+        double t = unit(rng);
+        near[3 * i] = p; near[3 * i + 1] = q;
+        near[3 * i + 2] = {p[0] + t * (q[0] - p[0]), p[1] + t * (q[1] - p[1])};
+    }
+
+    using ms = std::chrono::duration<double, std::milli>;
+    auto run = [&](const char* name, const std::vector<P2>& pts) {
+        size_t hits = 0;
+        double sink = 0;
+        for (size_t i = 0; i < n; ++i) {
+            double det;
+            hits += orient2d_filter(pts[3 * i].data(), pts[3 * i + 1].data(), pts[3 * i + 2].data(), det);
+        }
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; ++i) sink += naive_orient2d(pts[3 * i], pts[3 * i + 1], pts[3 * i + 2]);
+        auto t1 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; ++i) sink += orient2d(pts[3 * i].data(), pts[3 * i + 1].data(), pts[3 * i + 2].data());
+        auto t2 = std::chrono::steady_clock::now();
+        std::cout << name << " filter hit rate " << 100.0 * hits / n << "%, cross product "
+                  << ms(t1 - t0).count() << " ms, orient2d " << ms(t2 - t1).count() << " ms"
+                  << (sink == 0.125 ? " " : "") << "\n";
+    };
+    run("orient2d random: ", rnd);
+    run("orient2d near:   ", near);
+    run("orient2d grid:   ", grid);
+
+    size_t hits3 = 0, hitsc = 0;
+    for (size_t i = 0; i + 3 < n; i += 4) {
+        P3 p[4];
+        for (auto& v : p) v = {coord(rng), coord(rng), coord(rng)};
+        double det;
+        hits3 += orient3d_filter(p[0].data(), p[1].data(), p[2].data(), p[3].data(), det);
+        hitsc += incircle_filter(rnd[i].data(), rnd[i + 1].data(), rnd[i + 2].data(), rnd[i + 3].data(), det);
+    }
+    std::cout << "orient3d random: filter hit rate " << 100.0 * hits3 / (n / 4) << "%\n";
+    std::cout << "incircle random: filter hit rate " << 100.0 * hitsc / (n / 4) << "%\n";
+
+    std::cout << "\n[TEST] orient2d exact on grid points: ";
+    size_t wrong = 0;
+    for (size_t i = 0; i < n; ++i) {
+        // small integers: the plain determinant is exact, so it is the reference
+        double ref = naive_orient2d(grid[3 * i], grid[3 * i + 1], grid[3 * i + 2]);
+        double got = orient2d(grid[3 * i].data(), grid[3 * i + 1].data(), grid[3 * i + 2].data());
+        if ((ref > 0) != (got > 0) || (ref < 0) != (got < 0)) ++wrong;
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] incircle exact on cocircular points: ";
+    wrong = 0;
+    for (int i = -50; i <= 50; ++i) {
+        // (i, 0), (0, i), (-i, 0) and (0, -i) all lie on one circle
+        if (i == 0) continue;
+        Point<2, double> a1{double(i), 0}, b1{0, double(i)}, c1{double(-i), 0}, d1{0, double(-i)};
+        if (incircle(a1, b1, c1, d1) != 0) ++wrong;
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    return 0;
+}
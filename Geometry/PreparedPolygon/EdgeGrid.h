@@ -0,0 +1,61 @@
+#ifndef EDGE_GRID_H
+#define EDGE_GRID_H
+
+#include "../Point/Point.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+
+// Edges bucketed into a uniform grid over their bounding box, about one cell
+// per edge and shaped like the box. Each edge goes into the cells it passes
+// within half a cell of, walked row by row along the edge, so an edge costs
+// the cells along it rather than its whole bounding box and the buckets take
+// O(n) space however long or diagonal the edges are. The half-cell margin
+// covers the step between neighbouring cell centres, the segment from a
+// centre to any point of its cell, and the rounding of column(), row() and
+// centre() in T. Built by PreparedPolygon, whose grid Clipper also searches.
+template <size_t D, typename T>
+class EdgeGrid {
+    static_assert(D == 2, "EdgeGrid is 2D only for this version.");
+
+public:
+    struct Edge { Point<2, T> a, b; };
+
+private:
+    std::vector<Edge> edges;
+    T min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+    T cell_w = 1, cell_h = 1;
+    size_t nx = 1, ny = 1;
+    std::vector<uint32_t> cell_start;   // CSR offsets into cell_edges, nx*ny + 1
+    std::vector<uint32_t> cell_edges;   // edge indices, in input order per cell
+
+public:
+    EdgeGrid() = default;
+    // Throws std::length_error when the edges or their bucket entries do not
+    // fit 32-bit indices
+    explicit EdgeGrid(std::vector<Edge> input);
+
+    size_t size() const { return edges.size(); }
+    bool empty() const { return edges.empty(); }
+    const Edge& operator[](size_t i) const { return edges[i]; }
+
+    size_t columns() const { return nx; }
+    size_t rows() const { return ny; }
+    // Whether p lies in the bounding box of the edges
+    bool covers(const Point<2, T>& p) const;
+    // Cell coordinates, clamped to the grid
+    size_t column(T x) const;
+    size_t row(T y) const;
+    size_t cell(size_t c, size_t r) const { return r * nx + c; }
+    Point<2, T> centre(size_t c, size_t r) const;
+    // Indices of the edges bucketed in one cell
+    std::span<const uint32_t> bucket(size_t cell) const;
+
+    // Every edge that may meet the box, sorted and without repeats; out is
+    // cleared first
+    void near(T lo_x, T lo_y, T hi_x, T hi_y, std::vector<uint32_t>& out) const;
+};
+
+#include "EdgeGrid.ipp"
+
+#endif // EDGE_GRID_H
@@ -0,0 +1,114 @@
+#ifndef EDGE_GRID_IPP
+#define EDGE_GRID_IPP
+
+#include "EdgeGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <limits>
+
+template <size_t D, typename T>
+EdgeGrid<D, T>::EdgeGrid(std::vector<Edge> input) : edges(std::move(input)) {
+    const size_t n = edges.size();
+    if (n > std::numeric_limits<uint32_t>::max()) throw std::length_error("Too many edges for EdgeGrid");
+    if (n == 0) return;
+
+    min_x = max_x = edges[0].a[0];
+    min_y = max_y = edges[0].a[1];
+    for (const Edge& e : edges)
+        for (const auto& p : {e.a, e.b}) {
+            min_x = std::min(min_x, p[0]); max_x = std::max(max_x, p[0]);
+            min_y = std::min(min_y, p[1]); max_y = std::max(max_y, p[1]);
+        }
+
+    double w = std::max<double>(max_x - min_x, 1e-30);
+    double h = std::max<double>(max_y - min_y, 1e-30);
+    double aspect = std::clamp(w / h, 1e-3, 1e3);
+    nx = std::clamp<size_t>(static_cast<size_t>(std::sqrt(n * aspect)), 1, 4096);
+    ny = std::clamp<size_t>(static_cast<size_t>(std::sqrt(n / aspect)), 1, 4096);
+    cell_w = static_cast<T>(w / nx);
+    cell_h = static_cast<T>(h / ny);
+    if (!(cell_w > 0)) cell_w = 1;
+    if (!(cell_h > 0)) cell_h = 1;
+
+    // rasterise each edge row by row in grid units
+    const double eps = std::numeric_limits<T>::epsilon();
+    const double mx = 0.5625 + 8 * eps * std::max(std::abs(double(min_x)), std::abs(double(max_x))) / cell_w;
+    const double my = 0.5625 + 8 * eps * std::max(std::abs(double(min_y)), std::abs(double(max_y))) / cell_h;
+    auto cells_of = [&](const Edge& e, auto&& visit) {
+        const double u0 = (double(e.a[0]) - min_x) / cell_w, v0 = (double(e.a[1]) - min_y) / cell_h;
+        const double u1 = (double(e.b[0]) - min_x) / cell_w, v1 = (double(e.b[1]) - min_y) / cell_h;
+        auto first = [](double v, size_t count) { return static_cast<size_t>(std::clamp(std::ceil(v), 0.0, double(count))); };
+        auto last = [](double v, size_t count) { return static_cast<size_t>(std::clamp(std::floor(v), -1.0, double(count) - 1) + 1); };
+        // rows r whose band [r - my, r + 1 + my] meets the edge, likewise columns
+        for (size_t r = first(std::min(v0, v1) - 1 - my, ny), r_end = last(std::max(v0, v1) + my, ny); r < r_end; ++r) {
+            double ulo = std::min(u0, u1), uhi = std::max(u0, u1);
+            if (v0 != v1) {
+                double ta = std::clamp((r - my - v0) / (v1 - v0), 0.0, 1.0);
+                double tb = std::clamp((r + 1 + my - v0) / (v1 - v0), 0.0, 1.0);
+                double ua = u0 + ta * (u1 - u0), ub = u0 + tb * (u1 - u0);
+                ulo = std::min(ua, ub);
+                uhi = std::max(ua, ub);
+            }
+            for (size_t c = first(ulo - 1 - mx, nx), c_end = last(uhi + mx, nx); c < c_end; ++c) visit(r * nx + c);
+        }
+    };
+
+    cell_start.assign(nx * ny + 1, 0);
+    uint64_t total = 0;
+    for (const Edge& e : edges) cells_of(e, [&](size_t c) { ++cell_start[c + 1]; ++total; });
+    if (total > std::numeric_limits<uint32_t>::max()) throw std::length_error("Too many edges for EdgeGrid");
+    for (size_t i = 1; i < cell_start.size(); ++i) cell_start[i] += cell_start[i - 1];
+
+    cell_edges.resize(cell_start.back());
+    std::vector<uint32_t> fill(cell_start.begin(), cell_start.end() - 1);
+    for (size_t i = 0; i < n; ++i)
+        cells_of(edges[i], [&](size_t c) { cell_edges[fill[c]++] = static_cast<uint32_t>(i); });
+}
+
+template <size_t D, typename T>
+bool EdgeGrid<D, T>::covers(const Point<2, T>& p) const {
+    return !edges.empty() && p[0] >= min_x && p[0] <= max_x && p[1] >= min_y && p[1] <= max_y;
+}
+
+template <size_t D, typename T>
+size_t EdgeGrid<D, T>::column(T x) const {
+    T f = (x - min_x) / cell_w;
+    if (!(f > 0)) return 0;
+    return std::min(static_cast<size_t>(std::min<T>(f, T(nx))), nx - 1);
+}
+
+template <size_t D, typename T>
+size_t EdgeGrid<D, T>::row(T y) const {
+    T f = (y - min_y) / cell_h;
+    if (!(f > 0)) return 0;
+    return std::min(static_cast<size_t>(std::min<T>(f, T(ny))), ny - 1);
+}
+
+template <size_t D, typename T>
+Point<2, T> EdgeGrid<D, T>::centre(size_t c, size_t r) const {
+    return Point<2, T>{min_x + (static_cast<T>(c) + T(0.5)) * cell_w, min_y + (static_cast<T>(r) + T(0.5)) * cell_h};
+}
+
+template <size_t D, typename T>
+std::span<const uint32_t> EdgeGrid<D, T>::bucket(size_t cell) const {
+    return std::span<const uint32_t>(cell_edges.data() + cell_start[cell], cell_start[cell + 1] - cell_start[cell]);
+}
+
+template <size_t D, typename T>
+void EdgeGrid<D, T>::near(T lo_x, T lo_y, T hi_x, T hi_y, std::vector<uint32_t>& out) const {
+    out.clear();
+    if (edges.empty() || hi_x < min_x || lo_x > max_x || hi_y < min_y || lo_y > max_y) return;
+    // the half-cell margin of the buckets covers the rounding of column()
+    // and row(), so the cells the box touches are enough
+    const size_t c0 = column(lo_x), c1 = column(hi_x), r0 = row(lo_y), r1 = row(hi_y);
+    for (size_t r = r0; r <= r1; ++r)
+        for (size_t c = c0; c <= c1; ++c) {
+            auto b = bucket(cell(c, r));
+            out.insert(out.end(), b.begin(), b.end());
+        }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+#endif // EDGE_GRID_IPP
@@ -0,0 +1,45 @@
+#ifndef PREPARED_POLYGON_H
+#define PREPARED_POLYGON_H
+
+#include "../Point/Point.h"
+#include "../Polygon/Polygon.h"
+#include "EdgeGrid.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+
+// Polygon preprocessed into a uniform grid of edge buckets (see EdgeGrid.h)
+// for repeated point-in-polygon queries. Each cell knows whether its centre is inside, so
+// a query only tests the segment from that centre to the point against the
+// few edges of the cell it lands in. Answers are exactly those of isInside,
+// boundary points included.
+template <size_t D, typename T>
+class PreparedPolygon {
+    static_assert(D == 2, "PreparedPolygon is 2D only for this version.");
+
+    using Edge = typename EdgeGrid<2, T>::Edge;
+
+    EdgeGrid<2, T> grid;                // edge i runs from vertex i to vertex i + 1
+    std::vector<uint8_t> centre_inside;
+
+    static bool crosses(const Edge& e, const Point<2, T>& p, const Point<2, T>& q);
+
+public:
+    PreparedPolygon() = default;
+    explicit PreparedPolygon(const Polygon<2, T>& poly);
+
+    // Edge i runs from vertex i to vertex i + 1, zero-length ones included
+    const EdgeGrid<2, T>& edges() const { return grid; }
+    size_t columns() const { return grid.columns(); }
+    size_t rows() const { return grid.rows(); }
+
+    bool contains(const Point<2, T>& p) const;
+
+    // Sets bit i of `mask` (LSB first within each word) when pts[i] is inside;
+    // `mask` needs at least ceil(pts.size() / 64) words.
+    void contains(std::span<const Point<2, T>> pts, std::span<uint64_t> mask) const;
+};
+
+#include "PreparedPolygon.ipp"
+
+#endif // PREPARED_POLYGON_H
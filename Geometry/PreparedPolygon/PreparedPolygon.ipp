@@ -0,0 +1,85 @@
+#ifndef PREPARED_POLYGON_IPP
+#define PREPARED_POLYGON_IPP
+
+#include "PreparedPolygon.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <limits>
+
+template <size_t D, typename T>
+PreparedPolygon<D, T>::PreparedPolygon(const Polygon<2, T>& poly) {
+    const size_t n = poly.size();
+    if (n < 3) throw std::invalid_argument("Polygon must have at least 3 vertices");
+    if (n > std::numeric_limits<uint32_t>::max())
+        throw std::length_error("Polygon too large to prepare");
+
+    std::vector<Edge> edges(n);
+    for (size_t i = 0; i < n; ++i) edges[i] = {poly[i], poly[(i + 1) % n]};
+    grid = EdgeGrid<2, T>(std::move(edges));
+    const size_t nx = grid.columns(), ny = grid.rows();
+
+    // classify cell centres: the first one directly, then each from its
+    // neighbour by the edges crossing the step between them, up column 0 and
+    // along every row. Both centres of a step lie in the later cell's bucket
+    // range, so its edges are all the step can cross.
+    centre_inside.assign(nx * ny, 0);
+    centre_inside[0] = polygon_contains(poly, grid.centre(0, 0));
+    auto step = [&](size_t from, size_t to, const Point<2, T>& p, const Point<2, T>& q) {
+        bool inside = centre_inside[from];
+        for (uint32_t i : grid.bucket(to)) inside ^= crosses(grid[i], p, q);
+        centre_inside[to] = inside;
+    };
+    for (size_t r = 1; r < ny; ++r) step(grid.cell(0, r - 1), grid.cell(0, r), grid.centre(0, r - 1), grid.centre(0, r));
+    for (size_t r = 0; r < ny; ++r)
+        for (size_t c = 1; c < nx; ++c)
+            step(grid.cell(c - 1, r), grid.cell(c, r), grid.centre(c - 1, r), grid.centre(c, r));
+}
+
+// Whether segment p-q crosses edge e, with every edge moved by an
+// infinitesimal (-e1, -e2), e2 much smaller than e1. isInside breaks ties
+// the same way: its half-open rule puts vertices level with the query below
+// the ray, and points on an edge count as right of it. So inside(q) is
+// inside(p) flipped once per crossing, exactly, whatever lies on what.
+template <size_t D, typename T>
+bool PreparedPolygon<D, T>::crosses(const Edge& e, const Point<2, T>& p, const Point<2, T>& q) {
+    const Point<2, T>& a = e.a;
+    const Point<2, T>& b = e.b;
+    // boxes apart stay apart under the shift
+    if (std::max(a.dx(), b.dx()) < std::min(p.dx(), q.dx()) || std::min(a.dx(), b.dx()) > std::max(p.dx(), q.dx()) ||
+        std::max(a.dy(), b.dy()) < std::min(p.dy(), q.dy()) || std::min(a.dy(), b.dy()) > std::max(p.dy(), q.dy()))
+        return false;
+    auto sign = [](double v) { return (v > 0) - (v < 0); };
+
+    // p and q on the edge's line read as if moved by +(e1, e2)
+    int tie = a.dy() != b.dy() ? (b.dy() > a.dy() ? -1 : 1) : (b.dx() > a.dx() ? 1 : -1);
+    int sp = sign(orient2d(a, b, p)), sq = sign(orient2d(a, b, q));
+    if ((sp ? sp : tie) == (sq ? sq : tie)) return false;
+
+    // the edge's ends on the segment's line, moved by -(e1, e2)
+    tie = p.dy() != q.dy() ? (q.dy() > p.dy() ? 1 : -1) : (q.dx() > p.dx() ? -1 : 1);
+    int sa = sign(orient2d(p, q, a)), sb = sign(orient2d(p, q, b));
+    return (sa ? sa : tie) != (sb ? sb : tie);
+}
+
+template <size_t D, typename T>
+bool PreparedPolygon<D, T>::contains(const Point<2, T>& p) const {
+    if (!grid.covers(p)) return false;
+
+    size_t c = grid.column(p.dx()), r = grid.row(p.dy()), cell = grid.cell(c, r);
+    const Point<2, T> from = grid.centre(c, r);
+    bool inside = centre_inside[cell];
+    for (uint32_t i : grid.bucket(cell)) inside ^= crosses(grid[i], from, p);
+    return inside;
+}
+
+template <size_t D, typename T>
+void PreparedPolygon<D, T>::contains(std::span<const Point<2, T>> pts, std::span<uint64_t> mask) const {
+    if (mask.size() * 64 < pts.size())
+        throw std::invalid_argument("Bitmask too small for point batch");
+    std::fill(mask.begin(), mask.end(), 0);
+    for (size_t i = 0; i < pts.size(); ++i)
+        if (contains(pts[i])) mask[i / 64] |= uint64_t(1) << (i % 64);
+}
+
+#endif // PREPARED_POLYGON_IPP
@@ -0,0 +1,139 @@
+#include "PreparedPolygon.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+
+// Star-shaped geofence-like outline with n vertices (always simple)
+static Polygon<2, double> random_star(size_t n, std::mt19937& rng) {
+    std::uniform_real_distribution<double> jitter(-0.5, 0.5);
+    std::vector<Point<2, double>> pts;
+    for (size_t k = 0; k < n; ++k) {
+        double a = 2 * M_PI * k / n, r = 80 + 15 * std::sin(7 * a) + jitter(rng) * 100.0 / n;
+        pts.push_back(Point<2, double>{r * std::cos(a), r * std::sin(a)});
+    }
+    return Polygon<2, double>(std::move(pts));
+}
+
+int main() {
+    Polygon<2, float> tri({
+        Point<2, float>{0, 0}, Point<2, float>{4, 0}, Point<2, float>{2, 3}
+    });
+    PreparedPolygon<2, float> ptri(tri);
+    std::cout << "Grid: " << ptri.columns() << " x " << ptri.rows() << "\n";
+    std::cout << "Inside (2,1): " << (ptri.contains(Point<2, float>{2, 1}) ? "YES" : "NO") << "\n";
+    std::cout << "Inside (5,1): " << (ptri.contains(Point<2, float>{5, 1}) ? "YES" : "NO") << "\n";
+
+    std::cout << "\n=== PREPARED vs isInside ===\n\n";
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> coord(-110.0, 110.0);
+
+    for (size_t n : {3u, 100u, 10000u, 100000u}) {
+        Polygon<2, double> poly = random_star(n, rng);
+
+        auto t0 = std::chrono::steady_clock::now();
+        PreparedPolygon<2, double> prepared(poly);
+        auto t1 = std::chrono::steady_clock::now();
+
+        std::vector<Point<2, double>> pts(1000000);
+        for (auto& p : pts) p = Point<2, double>{coord(rng), coord(rng)};
+        std::vector<uint64_t> mask((pts.size() + 63) / 64);
+
+        auto t2 = std::chrono::steady_clock::now();
+        prepared.contains(pts, mask);
+        auto t3 = std::chrono::steady_clock::now();
+
+        const size_t checked = std::min<size_t>(pts.size(), 20000000 / n);
+        size_t mismatches = 0;
+        auto t4 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < checked; ++i) {
+            bool bit = (mask[i / 64] >> (i % 64)) & 1;
+            if (bit != poly.isInside(pts[i])) ++mismatches;
+        }
+        auto t5 = std::chrono::steady_clock::now();
+
+        using sec = std::chrono::duration<double>;
+        std::cout << "Vertices: " << n << "\n";
+        std::cout << "  prepare:   " << sec(t1 - t0).count() * 1e3 << " ms\n";
+        std::cout << "  prepared:  " << pts.size() / sec(t3 - t2).count() / 1e6 << " Mpts/s\n";
+        std::cout << "  isInside:  " << checked / sec(t5 - t4).count() / 1e6 << " Mpts/s\n";
+        std::cout << "  [TEST] agrees with isInside on " << checked << " random points: "
+                  << (mismatches == 0 ? "PASS" : "FAIL") << " (" << mismatches << " mismatches)\n";
+    }
+
+    // Long spikes cross many cells each; bucketing by bounding box made this
+    // quadratic in memory
+    std::cout << "\nSpiky star, 20000 vertices:\n";
+    std::vector<Point<2, double>> spikes;
+    for (size_t k = 0; k < 20000; ++k) {
+        double a = 2 * M_PI * k / 20000, r = k % 2 ? 100 : 1;
+        spikes.push_back(Point<2, double>{r * std::cos(a), r * std::sin(a)});
+    }
+    Polygon<2, double> spiky(std::move(spikes));
+    auto s0 = std::chrono::steady_clock::now();
+    PreparedPolygon<2, double> prepared_spiky(spiky);
+    auto s1 = std::chrono::steady_clock::now();
+    std::cout << "  prepare:   " << std::chrono::duration<double, std::milli>(s1 - s0).count() << " ms\n";
+    size_t spiky_mismatches = 0;
+    for (int i = 0; i < 2000; ++i) {
+        Point<2, double> q{coord(rng), coord(rng)};
+        spiky_mismatches += prepared_spiky.contains(q) != spiky.isInside(q);
+    }
+    std::cout << "  [TEST] agrees with isInside on 2000 random points: "
+              << (spiky_mismatches == 0 ? "PASS" : "FAIL") << " (" << spiky_mismatches << " mismatches)\n";
+
+    // Integer vertices and integer or half-integer queries put many points
+    // exactly on edges, on vertices and level with vertices
+    std::cout << "\n[TEST] Reported corner cases agree with isInside: ";
+    Polygon<2, double> t1({Point<2, double>{0, 0}, Point<2, double>{1, 0}, Point<2, double>{1, 3}});
+    Polygon<2, double> t2({Point<2, double>{927, 250}, Point<2, double>{-492, 250}, Point<2, double>{-300, -896}});
+    Point<2, double> q1{0.5, 1}, q2{313.5, 36.5};
+    bool ok = PreparedPolygon<2, double>(t1).contains(q1) == t1.isInside(q1) && t1.isInside(q1) &&
+              PreparedPolygon<2, double>(t2).contains(q2) == t2.isInside(q2);
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Agrees with isInside on integer polygons at every half-integer point: ";
+    size_t grid_mismatches = 0, grid_points = 0;
+    for (int trial = 0; trial < 400; ++trial) {
+        const int span = trial % 4 == 0 ? 2 : trial % 4 == 1 ? 10 : trial % 4 == 2 ? 40 : 1000;
+        std::uniform_int_distribution<int> grid(-span, span);
+        std::vector<Point<2, double>> pts;
+        std::vector<Point<2, float>> fpts;
+        const size_t n = 3 + rng() % 12;
+        for (size_t k = 0; k < n; ++k) {
+            // a star around the origin, snapped to the grid
+            double a = 2 * M_PI * k / n, r = span * (0.2 + 0.8 * (rng() % 1000) / 1000.0);
+            pts.push_back(Point<2, double>{std::round(r * std::cos(a)), std::round(r * std::sin(a))});
+            if (trial % 8 == 7) pts.back() = Point<2, double>{double(grid(rng)), double(grid(rng))};
+            fpts.push_back(Point<2, float>{float(pts.back()[0]), float(pts.back()[1])});
+        }
+        Polygon<2, double> poly(pts);
+        Polygon<2, float> fpoly(fpts);
+        PreparedPolygon<2, double> prepared(poly);
+        PreparedPolygon<2, float> fprepared(fpoly);
+        const int steps = std::min(span, 40);
+        for (int i = -2 * steps - 1; i <= 2 * steps + 1; ++i)
+            for (int j = -2 * steps - 1; j <= 2 * steps + 1; ++j) {
+                double x = span == steps ? i / 2.0 : std::round(i * span / (2.0 * steps)) + (i & 1) / 2.0;
+                double y = span == steps ? j / 2.0 : std::round(j * span / (2.0 * steps)) + (j & 1) / 2.0;
+                Point<2, double> q{x, y};
+                Point<2, float> fq{float(x), float(y)};
+                grid_mismatches += prepared.contains(q) != poly.isInside(q);
+                grid_mismatches += fprepared.contains(fq) != fpoly.isInside(fq);
+                grid_points += 2;
+            }
+    }
+    std::cout << (grid_mismatches == 0 ? "PASS" : "FAIL") << " (" << grid_mismatches << " of " << grid_points
+              << " mismatched)\n";
+
+    std::cout << "[TEST] Bitmask too small: ";
+    try {
+        std::vector<Point<2, float>> pts(65);
+        std::vector<uint64_t> mask(1);
+        ptri.contains(pts, mask);
+        std::cout << "FAIL\n";
+    } catch (const std::invalid_argument& e) { std::cout << "PASS (" << e.what() << ")\n"; }
+
+    return 0;
+}
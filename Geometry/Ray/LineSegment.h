@@ -4,6 +4,8 @@
 
 #include "../Point/Point.h"
 #include "../Vector/Vector_new.h"
+#include "../Predicates/Predicates.h"
+#include "../Stats/Stats.h"
 #include <optional>
 
 template <size_t D, typename T>
@@ -12,20 +14,27 @@ struct LineSegment {
     LineSegment(const Point<D, T>& a_, const Point<D, T>& b_) : a(a_), b(b_) {}
 
     std::optional<Point<D, T>> intersect(const LineSegment<D, T>& other) const {
-        Vector<D, T> d1 = b - a;
-        Vector<D, T> d2 = other.b - other.a;
-        Vector<D, T> d = other.a - a;
-
-        T denom = d1[0]*d2[1] - d1[1]*d2[0];
-        if (std::abs(denom) < 1e-10) return std::nullopt;
+        static_assert(D == 2, "LineSegment::intersect is 2-D only");
+        // side of each endpoint relative to the other segment's line (exact signs)
+        double o1 = orient2d(a, b, other.a), o2 = orient2d(a, b, other.b);
+        double o3 = orient2d(other.a, other.b, a), o4 = orient2d(other.a, other.b, b);
+
+        if (o1 == 0 && o2 == 0) {   // collinear
+            COMPGEO_COUNT(CollinearRejects);
+            return std::nullopt;
+        }
+        if ((o1 > 0 && o2 > 0) || (o1 < 0 && o2 < 0)) return std::nullopt;
+        if ((o3 > 0 && o4 > 0) || (o3 < 0 && o4 < 0)) return std::nullopt;
 
-        T t = (d[0]*d2[1] - d[1]*d2[0]) / denom;
-        T s = (d[0]*d1[1] - d[1]*d1[0]) / denom;
+        // other's line meets this segment where the orientation crosses zero
+        T t = static_cast<T>(o3 / (o3 - o4));
+        return a + (b - a) * t;
+    }
 
-        if (t >= 0 && t <= 1 && s >= 0 && s <= 1) {
-            return a + d1 * t;
-        }
-        return std::nullopt;
+    // True when both segments lie on one line
+    bool collinear(const LineSegment<D, T>& other) const {
+        static_assert(D == 2, "LineSegment::collinear is 2-D only");
+        return orient2d(a, b, other.a) == 0 && orient2d(a, b, other.b) == 0;
     }
 };
 
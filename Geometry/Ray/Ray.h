@@ -3,17 +3,22 @@
 
 #include "../Point/Point.h"
 #include "../Vector/Vector_new.h"
+#include "../Predicates/Predicates.h"
 #include <optional>
 #include <cmath>
 #include <algorithm>
 
 template <size_t D, typename T> struct LineSegment;
 template <size_t D, typename T> class Polygon;
+template <size_t D, typename T> class PolygonView;
 
 template <size_t D, typename T>
 class Ray {
     static_assert(D == 2 || D == 3, "Ray supports only 2D or 3D.");
 
+    static bool parallel(const Vector<D, T>& u, const Vector<D, T>& v);
+    static bool on_line(const Point<D, T>& a, const Point<D, T>& b, const Point<D, T>& p);
+
 public:
     Point<D, T> origin;
     Vector<D, T> direction;
@@ -26,7 +31,10 @@ public:
     T length() const;
 
     std::optional<T> intersect(const LineSegment<D, T>& seg) const;
-    std::optional<T> intersect(const Polygon<D, T>& poly) const;    
+    // 2D only; constrained so overload resolution for a 3D ray never
+    // instantiates the 2D-only polygon types
+    std::optional<T> intersect(const Polygon<D, T>& poly) const requires (D == 2);
+    std::optional<T> intersect(const PolygonView<D, T>& poly) const requires (D == 2);
     std::optional<T> intersect(const Ray<D, T>& other) const;
 
     friend std::ostream& operator<<(std::ostream& os, const Ray& r) {
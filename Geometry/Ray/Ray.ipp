@@ -2,8 +2,13 @@
 #include <stdexcept>
 #include <limits>
 #include <optional>
+#include <array>
+#include <algorithm>
+#include <cmath>
 #include "LineSegment.h"
+#include "../Stats/Stats.h"
 #include "../Polygon/Polygon.h"
+#include "../Polygon/PolygonView.h"
 
 template <size_t D, typename T>
 Ray<D, T>::Ray(const Point<D, T>& orig, const Vector<D, T>& dir)
@@ -24,33 +29,86 @@ T Ray<D, T>::length() const {
     return direction.magnitude();
 }
 
+// Exact test for u x v == 0, one orient2d per coordinate plane
+template <size_t D, typename T>
+bool Ray<D, T>::parallel(const Vector<D, T>& u, const Vector<D, T>& v)
+{
+    const Point<2, T> zero;
+    for (size_t i = 0; i < (D == 2 ? 1 : 3); ++i) {
+        size_t j = (i + 1) % D;
+        if (orient2d(zero, Point<2, T>{u[i], u[j]}, Point<2, T>{v[i], v[j]}) != 0) return false;
+    }
+    return true;
+}
+
+// Exact test for p lying on the line through a and b
+template <size_t D, typename T>
+bool Ray<D, T>::on_line(const Point<D, T>& a, const Point<D, T>& b, const Point<D, T>& p)
+{
+    for (size_t i = 0; i < (D == 2 ? 1 : 3); ++i) {
+        size_t j = (i + 1) % D;
+        if (orient2d(Point<2, T>{a[i], a[j]}, Point<2, T>{b[i], b[j]}, Point<2, T>{p[i], p[j]}) != 0)
+            return false;
+    }
+    return true;
+}
+
 template <size_t D, typename T>
 std::optional<T> Ray<D, T>::intersect(const Ray<D, T>& other) const
 {
+    COMPGEO_TIME(RayIntersectRay);
     Vector<D, T> p = other.origin - origin;   // vector from this origin to other origin
     Vector<D, T> d1 = direction;
     Vector<D, T> d2 = other.direction;
 
     if constexpr (D == 2) {
-        T denom = d1[0] * d2[1] - d1[1] * d2[0];
-        if (std::abs(denom) < static_cast<T>(1e-10)) return std::nullopt; // parallel / collinear
+        // All three cross products through orient2d, as LineSegment does:
+        // the signs are exact, so a nonzero denom cannot round to zero and
+        // the t >= 0, s >= 0 tests cannot flip
+        const Point<2, T> zero;
+        const Point<2, T> pp{p[0], p[1]}, pd1{d1[0], d1[1]}, pd2{d2[0], d2[1]};
+        double denom = orient2d(zero, pd1, pd2);
+        if (denom == 0) { // parallel / collinear
+            COMPGEO_COUNT(ParallelRejects);
+            return std::nullopt;
+        }
 
-        T t = (p[0] * d2[1] - p[1] * d2[0]) / denom;
-        T s = (p[0] * d1[1] - p[1] * d1[0]) / denom;
+        double t = orient2d(zero, pp, pd2) / denom;
+        double s = orient2d(zero, pp, pd1) / denom;
 
-        if (t >= 0 && s >= 0) return t;
+        if (t >= 0 && s >= 0) return static_cast<T>(t);
         return std::nullopt;
     }
 
     if constexpr (D == 3) {
-        auto cross = Vector<D,T>::cross_product(d1, d2);
-        T denom = cross.squared_magnitude();
-        if (denom < static_cast<T>(1e-10)) return std::nullopt;
-
-        T t = Vector<D,T>::dot_product( Vector<D,T>::cross_product(p, d2), cross ) / denom;
-        T s = Vector<D,T>::dot_product( Vector<D,T>::cross_product(p, d1), cross ) / denom;
-
-        if (t >= 0 && s >= 0) return t;
+        if (parallel(d1, d2)) {
+            COMPGEO_COUNT(ParallelRejects);
+            return std::nullopt;
+        }
+        // Cross products one coordinate plane at a time through orient2d, in
+        // double, and d1 x d2 scaled by its largest component: squaring it in
+        // T underflows to 0 for tiny directions that are not parallel
+        const Point<2, T> zero;
+        auto cross = [&](const Vector<D, T>& u, const Vector<D, T>& v) {
+            std::array<double, 3> c;
+            for (size_t i = 0; i < 3; ++i) {
+                size_t j = (i + 1) % 3, k = (i + 2) % 3;
+                c[i] = orient2d(zero, Point<2, T>{u[j], u[k]}, Point<2, T>{v[j], v[k]});
+            }
+            return c;
+        };
+        auto dot = [](const std::array<double, 3>& a, const std::array<double, 3>& b) {
+            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        };
+        std::array<double, 3> n = cross(d1, d2);
+        const double scale = std::max({std::abs(n[0]), std::abs(n[1]), std::abs(n[2])});
+        for (double& c : n) c /= scale;
+        const double denom = dot(n, n) * scale;   // |d1 x d2|^2, over scale once
+
+        double t = dot(cross(p, d2), n) / denom;
+        double s = dot(cross(p, d1), n) / denom;
+
+        if (t >= 0 && s >= 0) return static_cast<T>(t);
         return std::nullopt;
     }
 }
@@ -58,23 +116,20 @@ std::optional<T> Ray<D, T>::intersect(const Ray<D, T>& other) const
 template <size_t D, typename T>
 std::optional<T> Ray<D, T>::intersect(const LineSegment<D, T>& seg) const
 {
+    COMPGEO_TIME(RayIntersectSegment);
     Vector<D, T> ab = seg.b - seg.a;
     T ab2 = ab.squared_magnitude();
-    if (ab2 == 0) return std::nullopt;
+    if (ab2 == 0) {
+        COMPGEO_COUNT(DegenerateRejects);
+        return std::nullopt;
+    }
 
     Vector<D, T> ap = origin - seg.a;
 
     T proj = Vector<D,T>::dot_product(ap, ab) / ab2;
 
-    if (proj >= 0 && proj <= 1) {
-        if constexpr (D == 2) {
-            T cross = direction[0]*ab[1] - direction[1]*ab[0];
-            if (std::abs(cross) < static_cast<T>(1e-6)) return T(0);
-        } else if constexpr (D == 3) {
-            auto cr = Vector<D,T>::cross_product(direction, ab);
-            if (cr.squared_magnitude() < static_cast<T>(1e-12)) return T(0);
-        }
-    }
+    // origin on the segment and moving along it: hit immediately
+    if (proj >= 0 && proj <= 1 && parallel(direction, ab) && on_line(seg.a, seg.b, origin)) return T(0);
 
     Ray<D,T> infLine(seg.a, ab);
     auto opt = intersect(infLine);
@@ -90,23 +145,15 @@ std::optional<T> Ray<D, T>::intersect(const LineSegment<D, T>& seg) const
 }
 
 template <size_t D, typename T>
-std::optional<T> Ray<D, T>::intersect(const Polygon<D, T>& poly) const
+std::optional<T> Ray<D, T>::intersect(const Polygon<D, T>& poly) const requires (D == 2)
 {
-    static_assert(D == 2, "Ray-Polygon intersection is 2-D only");
-
-    T t_min = std::numeric_limits<T>::max();
-    bool hit = false;
-
-    for (size_t i = 0; i < poly.size(); ++i) {
-        size_t j = (i + 1) % poly.size();
-        LineSegment<D, T> edge(poly[i], poly[j]);
-        auto opt = intersect(edge);
-        if (opt && *opt >= 0) {
-            if (*opt < t_min) t_min = *opt;
-            hit = true;
-        }
-    }
-    return hit ? std::optional<T>(t_min) : std::nullopt;
+    COMPGEO_TIME(RayIntersectPolygon);
+    return polygon_ray_cast(*this, poly);
 }
 
-template class Ray<2, float>;
\ No newline at end of file
+template <size_t D, typename T>
+std::optional<T> Ray<D, T>::intersect(const PolygonView<D, T>& poly) const requires (D == 2)
+{
+    COMPGEO_TIME(RayIntersectPolygon);
+    return polygon_ray_cast(*this, poly);
+}
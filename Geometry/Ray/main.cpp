@@ -1,6 +1,7 @@
 #include "Ray.h"
 #include "LineSegment.h"
 #include <iostream>
+#include <cmath>
 
 int main() {
     Point<2, float> o1{0, 0}, o2{3, 0};
@@ -31,5 +32,21 @@ int main() {
         std::cout << "No segment intersection\n";
     }
 
+    // The float cross product of these directions underflows to 0 although
+    // they are not parallel; the parameter must still come out finite
+    std::cout << "[TEST] Tiny crossing directions: ";
+    Ray<2, float> tiny1(Point<2, float>{0, 0}, Vector<2, float>{1e-25f, 0});
+    Ray<2, float> tiny2(Point<2, float>{1, -1}, Vector<2, float>{0, 1e-25f});
+    auto t_tiny = tiny1.intersect(tiny2);
+    bool ok = t_tiny && std::abs(*t_tiny / 1e25f - 1) < 1e-6f;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Tiny crossing directions in 3D: ";
+    Ray<3, float> tiny3a(Point<3, float>{0, 0, 0}, Vector<3, float>{1e-25f, 0, 0});
+    Ray<3, float> tiny3b(Point<3, float>{1, -1, 0}, Vector<3, float>{0, 1e-25f, 0});
+    auto t_tiny3 = tiny3a.intersect(tiny3b);
+    ok = t_tiny3 && std::abs(*t_tiny3 / 1e25f - 1) < 1e-6f;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
     return 0;
 }
\ No newline at end of file
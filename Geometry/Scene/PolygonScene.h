@@ -0,0 +1,79 @@
+#ifndef POLYGON_SCENE_H
+#define POLYGON_SCENE_H
+
+#include "../Point/Point.h"
+#include "../Vector/Vector_new.h"
+#include "../Ray/Ray.h"
+#include "../Polygon/Polygon.h"
+#include <vector>
+#include <optional>
+#include <limits>
+#include <cstdint>
+
+template <size_t D, typename T>
+struct SceneHit {
+    size_t polygon_id;
+    size_t edge_id;
+    T t;
+};
+
+// Many polygons with a bounding volume hierarchy over all of their edges,
+// so a ray only tests the edges whose boxes it actually crosses.
+template <size_t D, typename T>
+class PolygonScene {
+    static_assert(D == 2, "PolygonScene is 2D only for this version.");
+
+    struct Edge {
+        Point<2, T> a, b;
+        size_t polygon_id;
+        size_t edge_id;
+    };
+
+    struct Node {
+        T lo[2], hi[2];
+        uint32_t offset;   // leaf: first edge, interior: right child
+        uint32_t count;    // 0 for interior nodes
+    };
+
+    static constexpr uint32_t LEAF_SIZE = 4;
+    static constexpr size_t MAX_DEPTH = 64;
+
+    std::vector<Polygon<2, T>> polygons;
+    std::vector<Edge> edges;
+    std::vector<Node> nodes;
+    bool dirty = false;
+
+    uint32_t build_node(uint32_t first, uint32_t count, size_t depth);
+    bool hit_box(const Node& n, const T o[2], const T inv[2], T t_max) const;
+    static std::optional<T> hit_edge(const Ray<2, T>& r, const Edge& e);
+
+    template <typename Visit>
+    void traverse(const Ray<2, T>& r, T& t_max, Visit&& visit) const;
+
+public:
+    using Hit = SceneHit<D, T>;
+
+    PolygonScene() = default;
+    explicit PolygonScene(std::vector<Polygon<2, T>> polys);
+
+    size_t add(const Polygon<2, T>& poly);
+    void build();
+
+    size_t size() const { return polygons.size(); }
+    size_t edge_count() const { return edges.size(); }
+    const Polygon<2, T>& operator[](size_t i) const;
+
+    std::optional<Hit> closest_hit(const Ray<2, T>& r) const;
+    bool any_hit(const Ray<2, T>& r,
+                 T t_max = std::numeric_limits<T>::max()) const;
+    std::vector<Hit> all_hits(const Ray<2, T>& r) const;
+
+    std::vector<std::optional<Hit>> closest_hit(const std::vector<Ray<2, T>>& rays) const;
+    std::vector<uint8_t> any_hit(const std::vector<Ray<2, T>>& rays,
+                                 T t_max = std::numeric_limits<T>::max()) const;
+    std::vector<std::vector<Hit>> all_hits(const std::vector<Ray<2, T>>& rays) const;
+};
+
+#include "PolygonScene.ipp"
+
+#endif // POLYGON_SCENE_H
@@ -0,0 +1,229 @@
+#ifndef POLYGON_SCENE_IPP
+#define POLYGON_SCENE_IPP
+
+#include "PolygonScene.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+template <size_t D, typename T>
+PolygonScene<D, T>::PolygonScene(std::vector<Polygon<2, T>> polys)
+    : polygons(std::move(polys)) {
+    for (size_t p = 0; p < polygons.size(); ++p) {
+        const auto& poly = polygons[p];
+        for (size_t i = 0; i < poly.size(); ++i)
+            edges.push_back({poly[i], poly[(i + 1) % poly.size()], p, i});
+    }
+    build();
+}
+
+template <size_t D, typename T>
+size_t PolygonScene<D, T>::add(const Polygon<2, T>& poly) {
+    size_t id = polygons.size();
+    polygons.push_back(poly);
+    for (size_t i = 0; i < poly.size(); ++i)
+        edges.push_back({poly[i], poly[(i + 1) % poly.size()], id, i});
+    dirty = true;
+    return id;
+}
+
+template <size_t D, typename T>
+const Polygon<2, T>& PolygonScene<D, T>::operator[](size_t i) const {
+    if (i >= polygons.size()) throw std::out_of_range("PolygonScene index out of range");
+    return polygons[i];
+}
+
+template <size_t D, typename T>
+void PolygonScene<D, T>::build() {
+    if (edges.size() > std::numeric_limits<uint32_t>::max())
+        throw std::length_error("PolygonScene holds too many edges");
+    nodes.clear();
+    nodes.reserve(2 * edges.size() / LEAF_SIZE + 1);
+    if (!edges.empty())
+        build_node(0, static_cast<uint32_t>(edges.size()), 0);
+    dirty = false;
+}
+
+template <size_t D, typename T>
+uint32_t PolygonScene<D, T>::build_node(uint32_t first, uint32_t count, size_t depth) {
+    uint32_t index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back({});
+
+    T lo[2] = { std::numeric_limits<T>::max(), std::numeric_limits<T>::max() };
+    T hi[2] = { std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest() };
+    T clo[2] = { lo[0], lo[1] };
+    T chi[2] = { hi[0], hi[1] };
+    for (uint32_t i = first; i < first + count; ++i) {
+        const Edge& e = edges[i];
+        T xs[2] = { e.a.dx(), e.b.dx() };
+        T ys[2] = { e.a.dy(), e.b.dy() };
+        lo[0] = std::min({lo[0], xs[0], xs[1]});
+        lo[1] = std::min({lo[1], ys[0], ys[1]});
+        hi[0] = std::max({hi[0], xs[0], xs[1]});
+        hi[1] = std::max({hi[1], ys[0], ys[1]});
+        T cx = (xs[0] + xs[1]) / 2, cy = (ys[0] + ys[1]) / 2;
+        clo[0] = std::min(clo[0], cx); chi[0] = std::max(chi[0], cx);
+        clo[1] = std::min(clo[1], cy); chi[1] = std::max(chi[1], cy);
+    }
+
+    Node node{};
+    node.lo[0] = lo[0]; node.lo[1] = lo[1];
+    node.hi[0] = hi[0]; node.hi[1] = hi[1];
+
+    int axis = (chi[0] - clo[0] >= chi[1] - clo[1]) ? 0 : 1;
+    if (count <= LEAF_SIZE || depth + 1 >= MAX_DEPTH || chi[axis] == clo[axis]) {
+        node.offset = first;
+        node.count = count;
+        nodes[index] = node;
+        return index;
+    }
+
+    uint32_t half = count / 2;
+    auto centre = [axis](const Edge& e) {
+        return axis == 0 ? e.a.dx() + e.b.dx() : e.a.dy() + e.b.dy();
+    };
+    std::nth_element(edges.begin() + first, edges.begin() + first + half,
+                     edges.begin() + first + count,
+                     [&](const Edge& l, const Edge& r) { return centre(l) < centre(r); });
+
+    build_node(first, half, depth + 1);
+    node.offset = build_node(first + half, count - half, depth + 1);
+    node.count = 0;
+    nodes[index] = node;
+    return index;
+}
+
+template <size_t D, typename T>
+bool PolygonScene<D, T>::hit_box(const Node& n, const T o[2], const T inv[2], T t_max) const {
+    T t0 = 0, t1 = t_max;
+    for (int k = 0; k < 2; ++k) {
+        T a = (n.lo[k] - o[k]) * inv[k];
+        T b = (n.hi[k] - o[k]) * inv[k];
+        if (a > b) std::swap(a, b);
+        // NaN (origin on a slab of a flat box) leaves t0/t1 untouched
+        t0 = std::max(t0, a);
+        t1 = std::min(t1, b);
+        if (t0 > t1) return false;
+    }
+    return true;
+}
+
+template <size_t D, typename T>
+std::optional<T> PolygonScene<D, T>::hit_edge(const Ray<2, T>& r, const Edge& e) {
+    // The same cross products as Ray::intersect, through orient2d: the signs
+    // are exact, so a nonzero denom cannot round to zero and the t >= 0 and
+    // 0 <= s <= 1 tests cannot flip
+    const Point<2, T> zero;
+    const Point<2, T> w{e.a.dx() - r.origin.dx(), e.a.dy() - r.origin.dy()};
+    const Point<2, T> ed{e.b.dx() - e.a.dx(), e.b.dy() - e.a.dy()};
+    const Point<2, T> d{r.direction.dx(), r.direction.dy()};
+
+    double denom = orient2d(zero, d, ed);
+    if (denom == 0) return std::nullopt; // parallel / collinear
+
+    double t = orient2d(zero, w, ed) / denom;
+    double s = orient2d(zero, w, d) / denom;
+    if (t >= 0 && s >= 0 && s <= 1) return static_cast<T>(t);
+    return std::nullopt;
+}
+
+// Visits every edge whose box the ray reaches before t_max. `visit` may shrink
+// t_max to prune the rest of the walk, and returns true to stop early.
+template <size_t D, typename T>
+template <typename Visit>
+void PolygonScene<D, T>::traverse(const Ray<2, T>& r, T& t_max, Visit&& visit) const {
+    if (dirty) throw std::logic_error("PolygonScene::build() must be called after add()");
+    if (nodes.empty()) return;
+
+    T o[2] = { r.origin.dx(), r.origin.dy() };
+    T inv[2] = { T(1) / r.direction.dx(), T(1) / r.direction.dy() };
+
+    uint32_t stack[MAX_DEPTH];
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Node& n = nodes[stack[--top]];
+        if (!hit_box(n, o, inv, t_max)) continue;
+        if (n.count > 0) {
+            for (uint32_t i = n.offset; i < n.offset + n.count; ++i) {
+                const Edge& e = edges[i];
+                auto t = hit_edge(r, e);
+                if (t && *t <= t_max && visit(e, *t)) return;
+            }
+            continue;
+        }
+        // left child is stored right after its parent
+        uint32_t left = static_cast<uint32_t>(&n - nodes.data()) + 1;
+        uint32_t right = n.offset;
+        const Node& l = nodes[left];
+        const Node& rn = nodes[right];
+        // push the farther child first so the nearer one is popped next
+        int axis = std::abs(r.direction.dx()) >= std::abs(r.direction.dy()) ? 0 : 1;
+        bool left_first = (inv[axis] >= 0) ? l.lo[axis] <= rn.lo[axis]
+                                           : l.hi[axis] >= rn.hi[axis];
+        stack[top++] = left_first ? right : left;
+        stack[top++] = left_first ? left : right;
+    }
+}
+
+template <size_t D, typename T>
+std::optional<SceneHit<D, T>> PolygonScene<D, T>::closest_hit(const Ray<2, T>& r) const {
+    T t_max = std::numeric_limits<T>::max();
+    std::optional<Hit> best;
+    traverse(r, t_max, [&](const Edge& e, T t) {
+        if (!best || t < best->t) {
+            best = Hit{e.polygon_id, e.edge_id, t};
+            t_max = t;
+        }
+        return false;
+    });
+    return best;
+}
+
+template <size_t D, typename T>
+bool PolygonScene<D, T>::any_hit(const Ray<2, T>& r, T t_max) const {
+    bool hit = false;
+    traverse(r, t_max, [&](const Edge&, T) { hit = true; return true; });
+    return hit;
+}
+
+template <size_t D, typename T>
+std::vector<SceneHit<D, T>> PolygonScene<D, T>::all_hits(const Ray<2, T>& r) const {
+    T t_max = std::numeric_limits<T>::max();
+    std::vector<Hit> hits;
+    traverse(r, t_max, [&](const Edge& e, T t) {
+        hits.push_back({e.polygon_id, e.edge_id, t});
+        return false;
+    });
+    std::sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) {
+        if (a.t != b.t) return a.t < b.t;
+        if (a.polygon_id != b.polygon_id) return a.polygon_id < b.polygon_id;
+        return a.edge_id < b.edge_id;
+    });
+    return hits;
+}
+
+template <size_t D, typename T>
+std::vector<std::optional<SceneHit<D, T>>>
+PolygonScene<D, T>::closest_hit(const std::vector<Ray<2, T>>& rays) const {
+    std::vector<std::optional<Hit>> out(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) out[i] = closest_hit(rays[i]);
+    return out;
+}
+
+template <size_t D, typename T>
+std::vector<uint8_t> PolygonScene<D, T>::any_hit(const std::vector<Ray<2, T>>& rays, T t_max) const {
+    std::vector<uint8_t> out(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) out[i] = any_hit(rays[i], t_max);
+    return out;
+}
+
+template <size_t D, typename T>
+std::vector<std::vector<SceneHit<D, T>>>
+PolygonScene<D, T>::all_hits(const std::vector<Ray<2, T>>& rays) const {
+    std::vector<std::vector<Hit>> out(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) out[i] = all_hits(rays[i]);
+    return out;
+}
+
+#endif // POLYGON_SCENE_IPP
@@ -0,0 +1,87 @@
+#include "PolygonScene.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+
+static Polygon<2, float> random_polygon(std::mt19937& rng, float cx, float cy) {
+    std::uniform_real_distribution<float> radius(0.5f, 2.0f);
+    // 8-gon around (cx, cy) with jittered radii
+    std::vector<Point<2, float>> pts;
+    for (int k = 0; k < 8; ++k) {
+        float a = k * float(M_PI) / 4, r = radius(rng);
+        pts.push_back(Point<2, float>{cx + r * std::cos(a), cy + r * std::sin(a)});
+    }
+    return Polygon<2, float>({pts[0], pts[1], pts[2], pts[3], pts[4], pts[5], pts[6], pts[7]});
+}
+
+int main() {
+    Polygon<2, float> square({
+        Point<2, float>{1, -1}, Point<2, float>{3, -1},
+        Point<2, float>{3, 1}, Point<2, float>{1, 1}
+    });
+    Polygon<2, float> tri({
+        Point<2, float>{5, -2}, Point<2, float>{7, 0}, Point<2, float>{5, 2}
+    });
+
+    PolygonScene<2, float> small({square, tri});
+    Ray<2, float> r(Point<2, float>{0, 0}, Vector<2, float>{1, 0});
+
+    if (auto h = small.closest_hit(r))
+        std::cout << "Closest: polygon " << h->polygon_id << ", edge " << h->edge_id
+                  << ", t = " << h->t << "\n";
+    std::cout << "Any hit before t=0.5: " << (small.any_hit(r, 0.5f) ? "YES" : "NO") << "\n";
+    std::cout << "All hits:";
+    for (const auto& h : small.all_hits(r))
+        std::cout << " (" << h.polygon_id << ", " << h.edge_id << ", " << h.t << ")";
+    std::cout << "\n";
+
+    std::cout << "\n=== BVH vs BRUTE FORCE ===\n\n";
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> pos(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> ang(0.0f, 2 * float(M_PI));
+
+    std::vector<Polygon<2, float>> polys;
+    for (int i = 0; i < 5000; ++i) polys.push_back(random_polygon(rng, pos(rng), pos(rng)));
+
+    auto t0 = std::chrono::steady_clock::now();
+    PolygonScene<2, float> scene(polys);
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::vector<Ray<2, float>> rays;
+    for (int i = 0; i < 2000; ++i) {
+        float a = ang(rng);
+        rays.emplace_back(Point<2, float>{pos(rng), pos(rng)},
+                          Vector<2, float>{std::cos(a), std::sin(a)});
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+    auto fast = scene.closest_hit(rays);
+    auto t3 = std::chrono::steady_clock::now();
+
+    std::vector<std::optional<float>> slow(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i)
+        for (const auto& p : polys) {
+            auto t = rays[i].intersect(p);
+            if (t && (!slow[i] || *t < *slow[i])) slow[i] = t;
+        }
+    auto t4 = std::chrono::steady_clock::now();
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < rays.size(); ++i) {
+        if (fast[i].has_value() != slow[i].has_value()) ++mismatches;
+        else if (fast[i] && fast[i]->t != *slow[i]) ++mismatches;   // same arithmetic, same t
+    }
+
+    using ms = std::chrono::duration<double, std::milli>;
+    std::cout << "Polygons: " << scene.size() << ", edges: " << scene.edge_count()
+              << ", rays: " << rays.size() << "\n";
+    std::cout << "BVH build:   " << ms(t1 - t0).count() << " ms\n";
+    std::cout << "BVH queries: " << ms(t3 - t2).count() << " ms\n";
+    std::cout << "Brute force: " << ms(t4 - t3).count() << " ms\n";
+    std::cout << "[TEST] BVH agrees with brute force: "
+              << (mismatches == 0 ? "PASS" : "FAIL") << " (" << mismatches << " mismatches)\n";
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#ifndef POINT_SOA_H
+#define POINT_SOA_H
+
+#include "../Point/Point.h"
+#include "VectorSoA.h"
+#include <array>
+#include <vector>
+
+// Structure-of-arrays buffer of D-dimensional points, the batch counterpart
+// of std::vector<Point<D, Coord_t>>.
+template <size_t D, typename Coord_t>
+class PointSoA {
+    static_assert(D >= 1, "Dimension must be at least 1");
+    static_assert(std::is_arithmetic<Coord_t>::value,
+                  "Coordinate type must be arithmetic");
+
+    std::array<std::vector<Coord_t>, D> coords;
+
+public:
+    PointSoA() = default;
+    explicit PointSoA(size_t n);
+    explicit PointSoA(const std::vector<Point<D, Coord_t>>& pts);
+
+    std::vector<Point<D, Coord_t>> to_points() const;
+
+    size_t size() const { return coords[0].size(); }
+    void resize(size_t n);
+    void push_back(const Point<D, Coord_t>& p);
+
+    Point<D, Coord_t> get(size_t i) const;
+    void set(size_t i, const Point<D, Coord_t>& p);
+
+    Coord_t* data(size_t axis) { return coords[axis].data(); }
+    const Coord_t* data(size_t axis) const { return coords[axis].data(); }
+
+    void translate(const Vector<D, Coord_t>& v);
+    void translate(const VectorSoA<D, Coord_t>& vs);
+
+    // out[i] = a[i] - b[i], the batch form of Point - Point
+    static void difference(const PointSoA& a, const PointSoA& b, VectorSoA<D, Coord_t>& out);
+    // out[i] = |a[i] - b[i]|
+    static void distance(const PointSoA& a, const PointSoA& b, std::vector<Coord_t>& out);
+    // out[i] = |(*this)[i] - p|
+    void distance_to(const Point<D, Coord_t>& p, std::vector<Coord_t>& out) const;
+};
+
+#include "PointSoA.ipp"
+
+#endif // POINT_SOA_H
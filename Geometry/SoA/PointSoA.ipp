@@ -0,0 +1,81 @@
+#include "PointSoA.h"
+#include <stdexcept>
+
+template <size_t D, typename Coord_t>
+PointSoA<D, Coord_t>::PointSoA(size_t n) {
+    resize(n);
+}
+
+template <size_t D, typename Coord_t>
+PointSoA<D, Coord_t>::PointSoA(const std::vector<Point<D, Coord_t>>& pts) {
+    resize(pts.size());
+    for (size_t i = 0; i < pts.size(); ++i)
+        for (size_t k = 0; k < D; ++k) coords[k][i] = pts[i][k];
+}
+
+template <size_t D, typename Coord_t>
+std::vector<Point<D, Coord_t>> PointSoA<D, Coord_t>::to_points() const {
+    std::vector<Point<D, Coord_t>> res(size());
+    for (size_t i = 0; i < size(); ++i)
+        for (size_t k = 0; k < D; ++k) res[i][k] = coords[k][i];
+    return res;
+}
+
+template <size_t D, typename Coord_t>
+void PointSoA<D, Coord_t>::resize(size_t n) {
+    for (auto& c : coords) c.resize(n);
+}
+
+template <size_t D, typename Coord_t>
+void PointSoA<D, Coord_t>::push_back(const Point<D, Coord_t>& p) {
+    for (size_t k = 0; k < D; ++k) coords[k].push_back(p[k]);
+}
+
+template <size_t D, typename Coord_t>
+Point<D, Coord_t> PointSoA<D, Coord_t>::get(size_t i) const {
+    if (i >= size()) throw std::out_of_range("PointSoA index out of range");
+    Point<D, Coord_t> res;
+    for (size_t k = 0; k < D; ++k) res[k] = coords[k][i];
+    return res;
+}
+
+template <size_t D, typename Coord_t>
+void PointSoA<D, Coord_t>::set(size_t i, const Point<D, Coord_t>& p) {
+    if (i >= size()) throw std::out_of_range("PointSoA index out of range");
+    for (size_t k = 0; k < D; ++k) coords[k][i] = p[k];
+}
+
+template <size_t D, typename Coord_t>
+void PointSoA<D, Coord_t>::translate(const Vector<D, Coord_t>& v) {
+    for (size_t k = 0; k < D; ++k) soa_add_scalar(data(k), v[k], size());
+}
+
+template <size_t D, typename Coord_t>
+void PointSoA<D, Coord_t>::translate(const VectorSoA<D, Coord_t>& vs) {
+    if (vs.size() != size()) throw std::invalid_argument("PointSoA and VectorSoA sizes must match");
+    for (size_t k = 0; k < D; ++k) soa_add(data(k), vs.data(k), size());
+}
+
+template <size_t D, typename Coord_t>
+void PointSoA<D, Coord_t>::difference(const PointSoA& a, const PointSoA& b,
+                                      VectorSoA<D, Coord_t>& out) {
+    if (a.size() != b.size()) throw std::invalid_argument("PointSoA sizes must match");
+    out.resize(a.size());
+    for (size_t k = 0; k < D; ++k) soa_sub(out.data(k), a.data(k), b.data(k), a.size());
+}
+
+template <size_t D, typename Coord_t>
+void PointSoA<D, Coord_t>::distance(const PointSoA& a, const PointSoA& b,
+                                    std::vector<Coord_t>& out) {
+    if (a.size() != b.size()) throw std::invalid_argument("PointSoA sizes must match");
+    out.assign(a.size(), Coord_t(0));
+    for (size_t k = 0; k < D; ++k) soa_sub_sq_add(out.data(), a.data(k), b.data(k), a.size());
+    soa_sqrt(out.data(), out.size());
+}
+
+template <size_t D, typename Coord_t>
+void PointSoA<D, Coord_t>::distance_to(const Point<D, Coord_t>& p, std::vector<Coord_t>& out) const {
+    out.assign(size(), Coord_t(0));
+    for (size_t k = 0; k < D; ++k) soa_sub_scalar_sq_add(out.data(), data(k), p[k], size());
+    soa_sqrt(out.data(), out.size());
+}
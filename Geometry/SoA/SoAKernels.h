@@ -0,0 +1,582 @@
+#ifndef SOA_KERNELS_H
+#define SOA_KERNELS_H
+
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include <cstdint>
+#include <limits>
+#include <iterator>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Element-wise kernels over plain coordinate arrays. float and double use
+// AVX2 (8/4 lanes) or SSE2 (4/2 lanes) when the compiler targets them; every
+// other case runs the scalar tail loop only.
+//
+// mul_add(a, b, c) is a * b + c and mul_sub(a, b, c) is a * b - c, fused
+// into one rounding exactly when the target has FMA. Code whose scalar and
+// vector paths must agree to the bit spells its products out with these,
+// since the compiler is otherwise free to contract either path on its own.
+
+template <typename T>
+struct SimdOps {
+    static constexpr size_t width = 1;
+};
+
+#if defined(__AVX2__)
+
+template <>
+struct SimdOps<float> {
+    using reg = __m256;
+    static constexpr size_t width = 8;
+    static reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, reg r) { _mm256_storeu_ps(p, r); }
+    static reg set1(float s) { return _mm256_set1_ps(s); }
+    static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+#if defined(__FMA__)
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_fmadd_ps(a, b, c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm256_fmsub_ps(a, b, c); }
+#else
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm256_sub_ps(_mm256_mul_ps(a, b), c); }
+#endif
+    static reg div(reg a, reg b) { return _mm256_div_ps(a, b); }
+    static reg sqrt(reg a) { return _mm256_sqrt_ps(a); }
+    static reg gt(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static reg ge(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static reg bit_and(reg a, reg b) { return _mm256_and_ps(a, b); }
+    static int movemask(reg m) { return _mm256_movemask_ps(m); }
+    static reg select(reg m, reg a, reg b) { return _mm256_blendv_ps(b, a, m); }
+    static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+    static reg swap_pairs(reg a) { return _mm256_permute_ps(a, 0xB1); }
+};
+
+template <>
+struct SimdOps<double> {
+    using reg = __m256d;
+    static constexpr size_t width = 4;
+    static reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, reg r) { _mm256_storeu_pd(p, r); }
+    static reg set1(double s) { return _mm256_set1_pd(s); }
+    static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+#if defined(__FMA__)
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_fmadd_pd(a, b, c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm256_fmsub_pd(a, b, c); }
+#else
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm256_sub_pd(_mm256_mul_pd(a, b), c); }
+#endif
+    static reg div(reg a, reg b) { return _mm256_div_pd(a, b); }
+    static reg sqrt(reg a) { return _mm256_sqrt_pd(a); }
+    static reg gt(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static reg ge(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+    static reg bit_and(reg a, reg b) { return _mm256_and_pd(a, b); }
+    static int movemask(reg m) { return _mm256_movemask_pd(m); }
+    static reg select(reg m, reg a, reg b) { return _mm256_blendv_pd(b, a, m); }
+    static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+    static reg swap_pairs(reg a) { return _mm256_permute_pd(a, 0x5); }
+};
+
+#elif defined(__SSE2__)
+
+template <>
+struct SimdOps<float> {
+    using reg = __m128;
+    static constexpr size_t width = 4;
+    static reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, reg r) { _mm_storeu_ps(p, r); }
+    static reg set1(float s) { return _mm_set1_ps(s); }
+    static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+#if defined(__FMA__)
+    static reg mul_add(reg a, reg b, reg c) { return _mm_fmadd_ps(a, b, c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm_fmsub_ps(a, b, c); }
+#else
+    static reg mul_add(reg a, reg b, reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm_sub_ps(_mm_mul_ps(a, b), c); }
+#endif
+    static reg div(reg a, reg b) { return _mm_div_ps(a, b); }
+    static reg sqrt(reg a) { return _mm_sqrt_ps(a); }
+    static reg gt(reg a, reg b) { return _mm_cmpgt_ps(a, b); }
+    static reg ge(reg a, reg b) { return _mm_cmpge_ps(a, b); }
+    static reg bit_and(reg a, reg b) { return _mm_and_ps(a, b); }
+    static int movemask(reg m) { return _mm_movemask_ps(m); }
+    static reg select(reg m, reg a, reg b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+    static reg swap_pairs(reg a) { return _mm_shuffle_ps(a, a, 0xB1); }
+};
+
+template <>
+struct SimdOps<double> {
+    using reg = __m128d;
+    static constexpr size_t width = 2;
+    static reg load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, reg r) { _mm_storeu_pd(p, r); }
+    static reg set1(double s) { return _mm_set1_pd(s); }
+    static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_pd(a, b); }
+#if defined(__FMA__)
+    static reg mul_add(reg a, reg b, reg c) { return _mm_fmadd_pd(a, b, c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm_fmsub_pd(a, b, c); }
+#else
+    static reg mul_add(reg a, reg b, reg c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm_sub_pd(_mm_mul_pd(a, b), c); }
+#endif
+    static reg div(reg a, reg b) { return _mm_div_pd(a, b); }
+    static reg sqrt(reg a) { return _mm_sqrt_pd(a); }
+    static reg gt(reg a, reg b) { return _mm_cmpgt_pd(a, b); }
+    static reg ge(reg a, reg b) { return _mm_cmpge_pd(a, b); }
+    static reg bit_and(reg a, reg b) { return _mm_and_pd(a, b); }
+    static int movemask(reg m) { return _mm_movemask_pd(m); }
+    static reg select(reg m, reg a, reg b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+    static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+    static reg swap_pairs(reg a) { return _mm_shuffle_pd(a, a, 1); }
+};
+
+#endif
+
+// x[i] += s
+template <typename T>
+void soa_add_scalar(T* x, T s, size_t n) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        auto vs = S::set1(s);
+        for (; i + S::width <= n; i += S::width)
+            S::store(x + i, S::add(S::load(x + i), vs));
+    }
+    for (; i < n; ++i) x[i] += s;
+}
+
+// x[i] += y[i]
+template <typename T>
+void soa_add(T* x, const T* y, size_t n) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width)
+            S::store(x + i, S::add(S::load(x + i), S::load(y + i)));
+    }
+    for (; i < n; ++i) x[i] += y[i];
+}
+
+// out[i] = a[i] - b[i]
+template <typename T>
+void soa_sub(T* out, const T* a, const T* b, size_t n) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width)
+            S::store(out + i, S::sub(S::load(a + i), S::load(b + i)));
+    }
+    for (; i < n; ++i) out[i] = a[i] - b[i];
+}
+
+// out[i] += (a[i] - b[i])^2
+template <typename T>
+void soa_sub_sq_add(T* out, const T* a, const T* b, size_t n) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width) {
+            auto d = S::sub(S::load(a + i), S::load(b + i));
+            S::store(out + i, S::add(S::load(out + i), S::mul(d, d)));
+        }
+    }
+    for (; i < n; ++i) { T d = a[i] - b[i]; out[i] += d * d; }
+}
+
+// out[i] += (a[i] - s)^2
+template <typename T>
+void soa_sub_scalar_sq_add(T* out, const T* a, T s, size_t n) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        auto vs = S::set1(s);
+        for (; i + S::width <= n; i += S::width) {
+            auto d = S::sub(S::load(a + i), vs);
+            S::store(out + i, S::add(S::load(out + i), S::mul(d, d)));
+        }
+    }
+    for (; i < n; ++i) { T d = a[i] - s; out[i] += d * d; }
+}
+
+// x[i] = sqrt(x[i])
+template <typename T>
+void soa_sqrt(T* x, size_t n) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width)
+            S::store(x + i, S::sqrt(S::load(x + i)));
+    }
+    for (; i < n; ++i) x[i] = static_cast<T>(std::sqrt(x[i]));
+}
+
+// The kernels below take D component arrays at once and make a single pass:
+// every element is loaded once and nothing goes through a temporary buffer.
+
+// out[i] = sum over k of a[k][i] * b[k][i], accumulated in axis order
+template <size_t D, typename T>
+void soa_dot(T* out, const T* const* a, const T* const* b, size_t n) {
+    const T* pa[D];
+    const T* pb[D];
+    for (size_t k = 0; k < D; ++k) { pa[k] = a[k]; pb[k] = b[k]; }
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width) {
+            auto sum = S::mul(S::load(pa[0] + i), S::load(pb[0] + i));
+            for (size_t k = 1; k < D; ++k) sum = S::add(sum, S::mul(S::load(pa[k] + i), S::load(pb[k] + i)));
+            S::store(out + i, sum);
+        }
+    }
+    for (; i < n; ++i) {
+        T sum = pa[0][i] * pb[0][i];
+        for (size_t k = 1; k < D; ++k) sum += pa[k][i] * pb[k][i];
+        out[i] = sum;
+    }
+}
+
+// out[i] = |x[i]|
+template <size_t D, typename T>
+void soa_norm(T* out, const T* const* x, size_t n) {
+    const T* px[D];
+    for (size_t k = 0; k < D; ++k) px[k] = x[k];
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width) {
+            auto v = S::load(px[0] + i), sum = S::mul(v, v);
+            for (size_t k = 1; k < D; ++k) { v = S::load(px[k] + i); sum = S::add(sum, S::mul(v, v)); }
+            S::store(out + i, S::sqrt(sum));
+        }
+    }
+    for (; i < n; ++i) {
+        T sum = px[0][i] * px[0][i];
+        for (size_t k = 1; k < D; ++k) sum += px[k][i] * px[k][i];
+        out[i] = static_cast<T>(std::sqrt(sum));
+    }
+}
+
+// x[i] *= 1 / |x[i]| in place, as Vector::normalized does; zero vectors stay zero
+template <size_t D, typename T>
+void soa_normalize(T* const* x, size_t n) {
+    T* px[D];
+    for (size_t k = 0; k < D; ++k) px[k] = x[k];
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        auto one = S::set1(1), zero = S::set1(0);
+        for (; i + S::width <= n; i += S::width) {
+            typename S::reg v[D];
+            v[0] = S::load(px[0] + i);
+            auto sum = S::mul(v[0], v[0]);
+            for (size_t k = 1; k < D; ++k) { v[k] = S::load(px[k] + i); sum = S::add(sum, S::mul(v[k], v[k])); }
+            auto r = S::select(S::gt(sum, zero), S::div(one, S::sqrt(sum)), one);
+            for (size_t k = 0; k < D; ++k) S::store(px[k] + i, S::mul(v[k], r));
+        }
+    }
+    for (; i < n; ++i) {
+        T sum = px[0][i] * px[0][i];
+        for (size_t k = 1; k < D; ++k) sum += px[k][i] * px[k][i];
+        if (!(sum > 0)) continue;
+        T r = T(1) / static_cast<T>(std::sqrt(sum));
+        for (size_t k = 0; k < D; ++k) px[k][i] *= r;
+    }
+}
+
+// out[i] = ax[i] * by[i] - ay[i] * bx[i]
+template <typename T>
+void soa_cross2(T* out, const T* ax, const T* ay, const T* bx, const T* by, size_t n) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width)
+            S::store(out + i, S::sub(S::mul(S::load(ax + i), S::load(by + i)),
+                                     S::mul(S::load(ay + i), S::load(bx + i))));
+    }
+    for (; i < n; ++i) out[i] = ax[i] * by[i] - ay[i] * bx[i];
+}
+
+// out[i] = a[i] x b[i] for 3D component arrays; out must not alias a or b
+template <typename T>
+void soa_cross3(T* const* out, const T* const* a, const T* const* b, size_t n) {
+    T* o[3] = {out[0], out[1], out[2]};
+    const T* pa[3] = {a[0], a[1], a[2]};
+    const T* pb[3] = {b[0], b[1], b[2]};
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width) {
+            typename S::reg va[3], vb[3];
+            for (size_t k = 0; k < 3; ++k) { va[k] = S::load(pa[k] + i); vb[k] = S::load(pb[k] + i); }
+            for (size_t k = 0; k < 3; ++k) {
+                size_t p = (k + 1) % 3, q = (k + 2) % 3;
+                S::store(o[k] + i, S::sub(S::mul(va[p], vb[q]), S::mul(va[q], vb[p])));
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        T ax = pa[0][i], ay = pa[1][i], az = pa[2][i], bx = pb[0][i], by = pb[1][i], bz = pb[2][i];
+        o[0][i] = ay * bz - az * by;
+        o[1][i] = az * bx - ax * bz;
+        o[2][i] = ax * by - ay * bx;
+    }
+}
+
+// In-place affine map of SoA coordinates; m is the row-major 2x3 matrix
+// [m00 m01 tx; m10 m11 ty]
+template <typename T>
+void soa_affine2(T* x, T* y, size_t n, const T* m) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        auto a = S::set1(m[0]), b = S::set1(m[1]), c = S::set1(m[2]);
+        auto d = S::set1(m[3]), e = S::set1(m[4]), f = S::set1(m[5]);
+        for (; i + S::width <= n; i += S::width) {
+            auto vx = S::load(x + i), vy = S::load(y + i);
+            S::store(x + i, S::add(S::add(S::mul(a, vx), S::mul(b, vy)), c));
+            S::store(y + i, S::add(S::add(S::mul(d, vx), S::mul(e, vy)), f));
+        }
+    }
+    for (; i < n; ++i) {
+        T vx = x[i], vy = y[i];
+        x[i] = m[0] * vx + m[1] * vy + m[2];
+        y[i] = m[3] * vx + m[4] * vy + m[5];
+    }
+}
+
+// The 3D form, m being the row-major 3x4 matrix
+template <typename T>
+void soa_affine3(T* x, T* y, T* z, size_t n, const T* m) {
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        typename S::reg r[12];
+        for (size_t k = 0; k < 12; ++k) r[k] = S::set1(m[k]);
+        for (; i + S::width <= n; i += S::width) {
+            auto vx = S::load(x + i), vy = S::load(y + i), vz = S::load(z + i);
+            T* out[3] = {x + i, y + i, z + i};
+            for (size_t k = 0; k < 3; ++k) {
+                const auto* row = r + 4 * k;
+                S::store(out[k], S::add(S::add(S::mul(row[0], vx), S::mul(row[1], vy)),
+                                        S::add(S::mul(row[2], vz), row[3])));
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        T vx = x[i], vy = y[i], vz = z[i];
+        x[i] = m[0] * vx + m[1] * vy + m[2] * vz + m[3];
+        y[i] = m[4] * vx + m[5] * vy + m[6] * vz + m[7];
+        z[i] = m[8] * vx + m[9] * vy + m[10] * vz + m[11];
+    }
+}
+
+// In-place affine map of n interleaved (x, y) pairs, m as for soa_affine2.
+// Lanes alternate x and y, so each output lane is p * v + q * swap(v) + r
+// with p = (m00, m11), q = (m01, m10), r = (tx, ty) repeated. When lo and hi
+// are given they receive the bounds of the mapped points, in the same pass.
+template <typename T>
+void xy_affine2(T* xy, size_t n, const T* m, T* lo = nullptr, T* hi = nullptr) {
+    const size_t len = 2 * n;
+    T min_x = std::numeric_limits<T>::max(), min_y = min_x;
+    T max_x = std::numeric_limits<T>::lowest(), max_y = max_x;
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        T pattern[3][S::width], mn[S::width], mx[S::width];
+        for (size_t k = 0; k < S::width; k += 2) {
+            pattern[0][k] = m[0]; pattern[0][k + 1] = m[4];
+            pattern[1][k] = m[1]; pattern[1][k + 1] = m[3];
+            pattern[2][k] = m[2]; pattern[2][k + 1] = m[5];
+        }
+        auto p = S::load(pattern[0]), q = S::load(pattern[1]), r = S::load(pattern[2]);
+        auto vmin = S::set1(min_x), vmax = S::set1(max_x);
+        for (; i + S::width <= len; i += S::width) {
+            auto v = S::load(xy + i);
+            v = S::add(S::add(S::mul(p, v), S::mul(q, S::swap_pairs(v))), r);
+            S::store(xy + i, v);
+            if (lo) {
+                vmin = S::min(vmin, v);
+                vmax = S::max(vmax, v);
+            }
+        }
+        S::store(mn, vmin);
+        S::store(mx, vmax);
+        for (size_t k = 0; k < S::width; k += 2) {
+            min_x = std::min(min_x, mn[k]); min_y = std::min(min_y, mn[k + 1]);
+            max_x = std::max(max_x, mx[k]); max_y = std::max(max_y, mx[k + 1]);
+        }
+    }
+    for (; i < len; i += 2) {
+        T vx = xy[i], vy = xy[i + 1];
+        xy[i] = m[0] * vx + m[1] * vy + m[2];
+        xy[i + 1] = m[3] * vx + m[4] * vy + m[5];
+        min_x = std::min(min_x, xy[i]); min_y = std::min(min_y, xy[i + 1]);
+        max_x = std::max(max_x, xy[i]); max_y = std::max(max_y, xy[i + 1]);
+    }
+    if (lo) { lo[0] = min_x; lo[1] = min_y; }
+    if (hi) { hi[0] = max_x; hi[1] = max_y; }
+}
+
+// Scalar stand-in with the SimdOps interface, so a kernel body can be
+// written once for the vector loop and its tail
+template <typename T>
+struct ScalarOps {
+    using reg = T;
+    static reg set1(T s) { return s; }
+    static reg add(reg a, reg b) { return a + b; }
+    static reg sub(reg a, reg b) { return a - b; }
+    static reg mul(reg a, reg b) { return a * b; }
+#if defined(__FMA__)
+    static reg mul_add(reg a, reg b, reg c) { return std::fma(a, b, c); }
+    static reg mul_sub(reg a, reg b, reg c) { return std::fma(a, b, -c); }
+#else
+    static reg mul_add(reg a, reg b, reg c) { return a * b + c; }
+    static reg mul_sub(reg a, reg b, reg c) { return a * b - c; }
+#endif
+    static reg max(reg a, reg b) { return std::max(a, b); }
+    static reg gt(reg a, reg b) { return a > b ? T(1) : T(0); }
+    static reg select(reg m, reg a, reg b) { return m != 0 ? a : b; }
+};
+
+// Cephes sin/cos polynomials on [-pi/4, pi/4] and pi/2 split in three so
+// the first two products with the quadrant number are exact
+template <typename T>
+struct SinCosCoeffs;
+
+template <>
+struct SinCosCoeffs<float> {
+    static constexpr float dp[3] = {1.5703125f, 4.837512969970703125e-4f, 7.54978995489188216e-8f};
+    static constexpr float sin[3] = {-1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f};
+    static constexpr float cos[3] = {2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f};
+    static constexpr float round_bias = 12582912.0f;   // 1.5 * 2^23
+    static constexpr float limit = 8192.0f;
+};
+
+template <>
+struct SinCosCoeffs<double> {
+    static constexpr double dp[3] = {1.570796251296997070312, 7.549789415861596353351e-8,
+                                     5.390302858158119051e-15};
+    static constexpr double sin[6] = {1.58962301576546568060e-10, -2.50507477628578072866e-8,
+                                      2.75573136213857245213e-6, -1.98412698295895385996e-4,
+                                      8.33333333332211858878e-3, -1.66666666666666307295e-1};
+    static constexpr double cos[6] = {-1.13585365213876817300e-11, 2.08757008419747316778e-9,
+                                      -2.75573141792967388112e-7, 2.48015872888517045348e-5,
+                                      -1.38888888888730564116e-3, 4.16666666666665929218e-2};
+    static constexpr double round_bias = 6755399441055744.0;   // 1.5 * 2^52
+    static constexpr double limit = 67108864.0;
+};
+
+// One register of sincos; arguments at or past the limit come out as those of 0
+template <typename T, typename Ops>
+void sincos_lanes(typename Ops::reg a, typename Ops::reg& c, typename Ops::reg& s) {
+    using K = SinCosCoeffs<T>;
+    using reg = typename Ops::reg;
+    const reg zero = Ops::set1(0), one = Ops::set1(1), two = Ops::set1(2), bias = Ops::set1(K::round_bias);
+    auto round = [&](reg v) { return Ops::sub(Ops::add(v, bias), bias); };
+
+    reg x = Ops::select(Ops::gt(Ops::set1(K::limit), Ops::max(a, Ops::sub(zero, a))), a, zero);
+    reg q = round(Ops::mul(x, Ops::set1(T(0.636619772367581343076))));
+    reg r = x;
+    for (T part : K::dp) r = Ops::sub(r, Ops::mul(q, Ops::set1(part)));
+    reg z = Ops::mul(r, r);
+
+    reg ps = Ops::set1(K::sin[0]), pc = Ops::set1(K::cos[0]);
+    for (size_t k = 1; k < std::size(K::sin); ++k) {
+        ps = Ops::add(Ops::mul(ps, z), Ops::set1(K::sin[k]));
+        pc = Ops::add(Ops::mul(pc, z), Ops::set1(K::cos[k]));
+    }
+    reg sn = Ops::add(r, Ops::mul(Ops::mul(r, z), ps));
+    reg cs = Ops::add(Ops::sub(one, Ops::mul(Ops::set1(T(0.5)), z)), Ops::mul(Ops::mul(z, z), pc));
+
+    // quadrant j = q mod 4 in floating point, so no integer lanes are needed;
+    // (sin, cos) is (sn, cs), (cs, -sn), (-sn, -cs) or (-cs, sn)
+    reg j = Ops::sub(q, Ops::mul(Ops::set1(4), round(Ops::sub(Ops::mul(q, Ops::set1(T(0.25))), Ops::set1(T(0.375))))));
+    reg upper = round(Ops::sub(Ops::mul(j, Ops::set1(T(0.5))), Ops::set1(T(0.25))));   // j >= 2
+    reg odd = Ops::sub(j, Ops::mul(two, upper));
+    reg sin_sign = Ops::sub(one, Ops::mul(two, upper));
+    reg cos_sign = Ops::mul(sin_sign, Ops::sub(one, Ops::mul(two, odd)));
+    s = Ops::mul(sin_sign, Ops::add(sn, Ops::mul(odd, Ops::sub(cs, sn))));
+    c = Ops::mul(cos_sign, Ops::add(cs, Ops::mul(odd, Ops::sub(sn, cs))));
+}
+
+// c[i] = cos(a[i]), s[i] = sin(a[i]) for float or double, vectorized.
+// Accurate to a few ulp while |a| is below 2^13 (float) or 2^26 (double);
+// larger arguments are rare and go to std::cos/std::sin.
+template <typename T>
+void soa_sincos(const T* a, T* c, T* s, size_t n) {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "soa_sincos needs float or double");
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        for (; i + S::width <= n; i += S::width) {
+            typename S::reg vc, vs;
+            sincos_lanes<T, S>(S::load(a + i), vc, vs);
+            S::store(c + i, vc);
+            S::store(s + i, vs);
+        }
+    }
+    for (; i < n; ++i) sincos_lanes<T, ScalarOps<T>>(a[i], c[i], s[i]);
+    for (i = 0; i < n; ++i) {
+        if (!(std::abs(a[i]) < SinCosCoeffs<T>::limit)) {
+            c[i] = std::cos(a[i]);
+            s[i] = std::sin(a[i]);
+        }
+    }
+}
+
+// x[i] += d[i] * cos(a[i]) - w[i], y[i] += d[i] * sin(a[i]) - h[i], the
+// operation order of Vector::moved, in one pass with sincos kept in
+// registers. A register holding an argument past the sincos limit (or a
+// NaN) is done lane by lane with std::cos/std::sin instead.
+template <typename T>
+void soa_move2(T* x, T* y, const T* w, const T* h, const T* a, const T* d, size_t n) {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "soa_move2 needs float or double");
+    auto one = [&](size_t i) {
+        T c, s;
+        if (std::abs(a[i]) < SinCosCoeffs<T>::limit) {
+            sincos_lanes<T, ScalarOps<T>>(a[i], c, s);
+        } else {
+            c = std::cos(a[i]);
+            s = std::sin(a[i]);
+        }
+        x[i] += d[i] * c - w[i];
+        y[i] += d[i] * s - h[i];
+    };
+    size_t i = 0;
+    if constexpr (SimdOps<T>::width > 1) {
+        using S = SimdOps<T>;
+        const typename S::reg limit = S::set1(SinCosCoeffs<T>::limit), zero = S::set1(0);
+        constexpr int all = (1 << S::width) - 1;
+        for (; i + S::width <= n; i += S::width) {
+            typename S::reg va = S::load(a + i);
+            if (S::movemask(S::gt(limit, S::max(va, S::sub(zero, va)))) != all) {
+                for (size_t k = i; k < i + S::width; ++k) one(k);
+                continue;
+            }
+            typename S::reg vc, vs, vd = S::load(d + i);
+            sincos_lanes<T, S>(va, vc, vs);
+            S::store(x + i, S::add(S::load(x + i), S::sub(S::mul(vd, vc), S::load(w + i))));
+            S::store(y + i, S::add(S::load(y + i), S::sub(S::mul(vd, vs), S::load(h + i))));
+        }
+    }
+    for (; i < n; ++i) one(i);
+}
+
+#endif // SOA_KERNELS_H
@@ -0,0 +1,62 @@
+#ifndef VECTOR_SOA_H
+#define VECTOR_SOA_H
+
+#include "../Vector/Vector_new.h"
+#include "SoAKernels.h"
+#include <array>
+#include <vector>
+#include <span>
+
+// Structure-of-arrays buffer of D-dimensional vectors: one contiguous array
+// per component, so batch operations run as straight vector loops.
+template <size_t D, typename Coord_t>
+class VectorSoA
+{
+    static_assert(D >= 1, "Dimension must be at least 1");
+    static_assert(std::is_arithmetic<Coord_t>::value,
+                  "Coord_t must be an arithmetic type");
+
+    std::array<std::vector<Coord_t>, D> components;
+
+    std::array<const Coord_t*, D> axes() const {
+        std::array<const Coord_t*, D> res;
+        for (size_t k = 0; k < D; ++k) res[k] = components[k].data();
+        return res;
+    }
+
+public:
+    VectorSoA() = default;
+    explicit VectorSoA(size_t n);
+    explicit VectorSoA(const std::vector<Vector<D, Coord_t>>& vs);
+
+    std::vector<Vector<D, Coord_t>> to_vectors() const;
+
+    size_t size() const { return components[0].size(); }
+    void resize(size_t n);
+    void push_back(const Vector<D, Coord_t>& v);
+
+    Vector<D, Coord_t> get(size_t i) const;
+    void set(size_t i, const Vector<D, Coord_t>& v);
+
+    Coord_t* data(size_t axis) { return components[axis].data(); }
+    const Coord_t* data(size_t axis) const { return components[axis].data(); }
+
+    // Batch operations, each one pass over the components; `out` is resized
+    // to size()
+    static void dot_product(const VectorSoA& a, const VectorSoA& b, std::vector<Coord_t>& out);
+    static void cross_2d(const VectorSoA& a, const VectorSoA& b, std::vector<Coord_t>& out);
+    static void cross_product(const VectorSoA& a, const VectorSoA& b, VectorSoA& out);
+    void squared_magnitude(std::vector<Coord_t>& out) const;
+    void magnitude(std::vector<Coord_t>& out) const;
+
+    // Normalizes every vector in place; zero vectors are left as zero
+    void normalize();
+
+    // Batch form of Vector::moved, in place:
+    // v[i] += d[i] * (cos a[i], sin a[i]) - (w[i], h[i]), in a single pass
+    void move(std::span<const Coord_t> w, std::span<const Coord_t> h,
+              std::span<const Coord_t> a, std::span<const Coord_t> d);
+};
+
+#include "VectorSoA.ipp"
+#endif // VECTOR_SOA_H
@@ -0,0 +1,115 @@
+#include "VectorSoA.h"
+#include <stdexcept>
+
+template <size_t D, typename Coord_t>
+VectorSoA<D, Coord_t>::VectorSoA(size_t n)
+{
+    resize(n);
+}
+
+template <size_t D, typename Coord_t>
+VectorSoA<D, Coord_t>::VectorSoA(const std::vector<Vector<D, Coord_t>>& vs)
+{
+    resize(vs.size());
+    for (size_t i = 0; i < vs.size(); ++i)
+        for (size_t k = 0; k < D; ++k) components[k][i] = vs[i][k];
+}
+
+template <size_t D, typename Coord_t>
+std::vector<Vector<D, Coord_t>> VectorSoA<D, Coord_t>::to_vectors() const
+{
+    std::vector<Vector<D, Coord_t>> res(size());
+    for (size_t i = 0; i < size(); ++i)
+        for (size_t k = 0; k < D; ++k) res[i][k] = components[k][i];
+    return res;
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::resize(size_t n)
+{
+    for (auto& c : components) c.resize(n);
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::push_back(const Vector<D, Coord_t>& v)
+{
+    for (size_t k = 0; k < D; ++k) components[k].push_back(v[k]);
+}
+
+template <size_t D, typename Coord_t>
+Vector<D, Coord_t> VectorSoA<D, Coord_t>::get(size_t i) const
+{
+    if (i >= size()) throw std::out_of_range("VectorSoA index out of range");
+    Vector<D, Coord_t> res;
+    for (size_t k = 0; k < D; ++k) res[k] = components[k][i];
+    return res;
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::set(size_t i, const Vector<D, Coord_t>& v)
+{
+    if (i >= size()) throw std::out_of_range("VectorSoA index out of range");
+    for (size_t k = 0; k < D; ++k) components[k][i] = v[k];
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::dot_product(const VectorSoA& a, const VectorSoA& b,
+                                        std::vector<Coord_t>& out)
+{
+    if (a.size() != b.size()) throw std::invalid_argument("VectorSoA sizes must match");
+    out.resize(a.size());
+    soa_dot<D>(out.data(), a.axes().data(), b.axes().data(), a.size());
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::cross_2d(const VectorSoA& a, const VectorSoA& b,
+                                     std::vector<Coord_t>& out)
+{
+    static_assert(D == 2, "cross_2d is only defined for 2-D vectors");
+    if (a.size() != b.size()) throw std::invalid_argument("VectorSoA sizes must match");
+    out.resize(a.size());
+    soa_cross2(out.data(), a.data(0), a.data(1), b.data(0), b.data(1), a.size());
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::cross_product(const VectorSoA& a, const VectorSoA& b, VectorSoA& out)
+{
+    static_assert(D == 3, "cross_product is only defined for 3-D vectors");
+    if (a.size() != b.size()) throw std::invalid_argument("VectorSoA sizes must match");
+    if (&out == &a || &out == &b) throw std::invalid_argument("cross_product output must not alias its inputs");
+    out.resize(a.size());
+    Coord_t* o[3] = {out.data(0), out.data(1), out.data(2)};
+    soa_cross3(o, a.axes().data(), b.axes().data(), a.size());
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::squared_magnitude(std::vector<Coord_t>& out) const
+{
+    dot_product(*this, *this, out);
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::magnitude(std::vector<Coord_t>& out) const
+{
+    out.resize(size());
+    soa_norm<D>(out.data(), axes().data(), size());
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::normalize()
+{
+    std::array<Coord_t*, D> x;
+    for (size_t k = 0; k < D; ++k) x[k] = data(k);
+    soa_normalize<D>(x.data(), size());
+}
+
+template <size_t D, typename Coord_t>
+void VectorSoA<D, Coord_t>::move(std::span<const Coord_t> w, std::span<const Coord_t> h,
+                                 std::span<const Coord_t> a, std::span<const Coord_t> d)
+{
+    static_assert(D == 2, "move() is only defined for 2-D vectors");
+    const size_t n = size();
+    if (w.size() != n || h.size() != n || a.size() != n || d.size() != n)
+        throw std::invalid_argument("VectorSoA::move argument sizes must match");
+    soa_move2(data(0), data(1), w.data(), h.data(), a.data(), d.data(), n);
+}
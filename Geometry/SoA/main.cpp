@@ -0,0 +1,133 @@
+#include "PointSoA.h"
+#include "VectorSoA.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+int main() {
+    std::vector<Point<2, float>> pts = {
+        Point<2, float>{3, 4}, Point<2, float>{1, 2}, Point<2, float>{0, 0}
+    };
+    PointSoA<2, float> ps(pts);
+    ps.translate(Vector<2, float>{1, 1});
+    std::cout << "Translated by (1,1):";
+    for (const auto& p : ps.to_points()) std::cout << " " << p;
+    std::cout << "\n";
+
+    std::vector<float> dist;
+    ps.distance_to(Point<2, float>{1, 1}, dist);
+    std::cout << "Distance to (1,1):";
+    for (float d : dist) std::cout << " " << d;
+    std::cout << "\n";
+
+    VectorSoA<2, float> vs(std::vector<Vector<2, float>>{
+        Vector<2, float>{3, 4}, Vector<2, float>{0, 0}, Vector<2, float>{0, 2}
+    });
+    vs.normalize();
+    std::cout << "Normalized (zero stays zero):";
+    for (const auto& v : vs.to_vectors()) std::cout << " " << v;
+    std::cout << "\n";
+
+    VectorSoA<3, float> a(std::vector<Vector<3, float>>{Vector<3, float>{1, 2, 3}});
+    VectorSoA<3, float> b(std::vector<Vector<3, float>>{Vector<3, float>{4, 5, 6}});
+    VectorSoA<3, float> c;
+    VectorSoA<3, float>::cross_product(a, b, c);
+    std::cout << "Cross product (3D): " << c.get(0) << "\n";
+
+    std::cout << "\n=== SoA vs AoS ===\n\n";
+
+    const size_t n = 1 << 20;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+    std::vector<Vector<2, float>> u(n), w(n);
+    for (size_t i = 0; i < n; ++i) {
+        u[i] = Vector<2, float>{coord(rng), coord(rng)};
+        w[i] = Vector<2, float>{coord(rng), coord(rng)};
+    }
+    VectorSoA<2, float> su(u), sw(w);
+
+    // Best of several warm runs, after one untimed run to fault the pages in
+    using ms = std::chrono::duration<double, std::milli>;
+    auto best = [](auto&& fn) {
+        fn();
+        double t = 1e300;
+        for (int r = 0; r < 10; ++r) {
+            auto t0 = std::chrono::steady_clock::now();
+            fn();
+            t = std::min(t, ms(std::chrono::steady_clock::now() - t0).count());
+        }
+        return t;
+    };
+    std::vector<float> aos(n), soa(n);
+
+    double t_aos = best([&] {
+        for (size_t i = 0; i < n; ++i) aos[i] = Vector<2, float>::dot_product(u[i], w[i]);
+    });
+    double t_soa = best([&] { VectorSoA<2, float>::dot_product(su, sw, soa); });
+    // Equal without FMA; with it the compiler may contract either side, so
+    // allow the rounding error bound of a two-term sum
+    const float eps = std::numeric_limits<float>::epsilon();
+    bool same = true;
+    for (size_t i = 0; i < n; ++i)
+        same = same && std::abs(aos[i] - soa[i]) <= 2 * eps * (std::abs(u[i][0] * w[i][0]) + std::abs(u[i][1] * w[i][1]));
+    std::cout << "dot_product  AoS: " << t_aos << " ms, SoA: " << t_soa << " ms\n";
+    std::cout << "[TEST] SoA dot matches AoS: " << (same ? "PASS" : "FAIL") << "\n";
+
+    t_aos = best([&] {
+        for (size_t i = 0; i < n; ++i) aos[i] = u[i].magnitude();
+    });
+    t_soa = best([&] { su.magnitude(soa); });
+    same = true;
+    for (size_t i = 0; i < n; ++i) same = same && std::abs(aos[i] - soa[i]) <= 2 * eps * aos[i];
+    std::cout << "magnitude    AoS: " << t_aos << " ms, SoA: " << t_soa << " ms\n";
+    std::cout << "[TEST] SoA magnitude matches AoS: " << (same ? "PASS" : "FAIL") << "\n";
+
+    // Timed on scratch copies refilled before each run, outside the timer
+    std::vector<Vector<2, float>> aos_n(n);
+    for (size_t i = 0; i < n; ++i) aos_n[i] = u[i].normalized();
+    VectorSoA<2, float> soa_n = su;
+    soa_n.normalize();
+    float worst = 0;
+    for (size_t i = 0; i < n; ++i) {
+        Vector<2, float> d = soa_n.get(i) - aos_n[i];
+        worst = std::max(worst, d.magnitude());
+    }
+    t_aos = t_soa = 1e300;
+    for (int r = 0; r < 10; ++r) {
+        aos_n = u;
+        soa_n = su;
+        auto t0 = std::chrono::steady_clock::now();
+        for (auto& v : aos_n) v = v.normalized();
+        auto t1 = std::chrono::steady_clock::now();
+        soa_n.normalize();
+        auto t2 = std::chrono::steady_clock::now();
+        t_aos = std::min(t_aos, ms(t1 - t0).count());
+        t_soa = std::min(t_soa, ms(t2 - t1).count());
+    }
+    std::cout << "normalize    AoS: " << t_aos << " ms, SoA: " << t_soa << " ms\n";
+    std::cout << "[TEST] SoA normalize matches AoS: " << (worst < 1e-5f ? "PASS" : "FAIL")
+              << " (max error " << worst << ")\n";
+
+    std::cout << "[TEST] Fused cross products match the scalar ones: ";
+    VectorSoA<3, float> a3, b3, c3;
+    for (size_t i = 0; i < 37; ++i) {
+        a3.push_back(Vector<3, float>{coord(rng), coord(rng), coord(rng)});
+        b3.push_back(Vector<3, float>{coord(rng), coord(rng), coord(rng)});
+    }
+    VectorSoA<3, float>::cross_product(a3, b3, c3);
+    VectorSoA<2, float>::cross_2d(su, sw, soa);
+    same = true;
+    for (size_t i = 0; i < a3.size(); ++i)
+        same = same && (c3.get(i) - Vector<3, float>::cross_product(a3.get(i), b3.get(i))).magnitude() < 1e-2f;
+    for (size_t i = 0; i < n; ++i)
+        same = same && std::abs(soa[i] - (u[i][0] * w[i][1] - u[i][1] * w[i][0])) <= 1e-3f * (1 + std::abs(soa[i]));
+    std::cout << (same ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "\n[TEST] Size mismatch: ";
+    try { VectorSoA<2, float>::dot_product(su, VectorSoA<2, float>(1), soa); std::cout << "FAIL\n"; }
+    catch (const std::invalid_argument& e) { std::cout << "PASS (" << e.what() << ")\n"; }
+
+    return 0;
+}
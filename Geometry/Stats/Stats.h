@@ -0,0 +1,147 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Opt-in instrumentation of the query hot paths. Build with
+// -DCOMPGEO_ENABLE_STATS (the same way in every translation unit) to count
+// work and time operations; without it the COMPGEO_* macros expand to
+// nothing, so instrumented code compiles exactly as before, and
+// stats_snapshot() reports enabled == false with all zeros.
+//
+// Each thread writes only its own counters and histograms, with relaxed
+// atomics and no locks or shared cache lines; a snapshot sums over the live
+// threads plus whatever exited threads left behind.
+
+enum class StatCounter : uint8_t {
+    EdgesTested,         // polygon edges (or edge pairs) run through a test
+    ParallelRejects,     // ray/ray tests dropped for parallel directions
+    CollinearRejects,    // segment pairs dropped for lying on one line
+    DegenerateRejects,   // zero-length segments dropped by a ray test
+    EarlyExits,          // polygon tests that stopped at the first hit
+    Count
+};
+
+enum class StatOp : uint8_t {
+    RayIntersectRay,
+    RayIntersectSegment,
+    RayIntersectPolygon,
+    PolygonContains,
+    PolygonIntersectSegment,
+    PolygonIntersectPolygon,
+    Count
+};
+
+inline constexpr size_t stat_counter_count = static_cast<size_t>(StatCounter::Count);
+inline constexpr size_t stat_op_count = static_cast<size_t>(StatOp::Count);
+// Latency bucket k holds calls that took [2^k, 2^(k+1)) ns; bucket 0 also
+// takes 0 and 1 ns, the last one everything longer
+inline constexpr size_t stat_buckets = 40;
+
+const char* stat_name(StatCounter c);
+const char* stat_name(StatOp op);
+
+struct StatsSnapshot {
+    struct Latency {
+        uint64_t calls = 0;
+        uint64_t total_ns = 0;
+        uint64_t buckets[stat_buckets] = {};
+
+        double mean_ns() const { return calls ? double(total_ns) / double(calls) : 0; }
+        // Upper edge of the bucket holding quantile q in [0, 1]
+        uint64_t percentile_ns(double q) const;
+    };
+
+    bool enabled = false;
+    uint64_t counters[stat_counter_count] = {};
+    Latency ops[stat_op_count];
+
+    uint64_t operator[](StatCounter c) const { return counters[static_cast<size_t>(c)]; }
+    const Latency& operator[](StatOp op) const { return ops[static_cast<size_t>(op)]; }
+
+    // {"enabled": true, "counters": {"edges_tested": 12, ...},
+    //  "operations": {"polygon_contains": {"calls": 3, "total_ns": 900,
+    //  "mean_ns": 300, "p50_ns": 256, "p90_ns": 512, "p99_ns": 512,
+    //  "histogram": [0, ...]}, ...}}
+    std::string json() const;
+};
+
+// Totals since start or the last stats_reset()
+StatsSnapshot stats_snapshot();
+// Starts a new measuring window; counts made by other threads while this
+// runs land on one side of it or the other
+void stats_reset();
+
+#ifdef COMPGEO_ENABLE_STATS
+
+#include <atomic>
+#include <chrono>
+
+// One per thread, created on its first recorded event
+struct StatsThread {
+    std::atomic<uint64_t> counters[stat_counter_count] = {};
+    std::atomic<uint64_t> calls[stat_op_count] = {};
+    std::atomic<uint64_t> total_ns[stat_op_count] = {};
+    std::atomic<uint64_t> buckets[stat_op_count][stat_buckets] = {};
+    unsigned depth = 0;   // timers open on this thread
+
+    StatsThread();
+    ~StatsThread();
+    StatsThread(const StatsThread&) = delete;
+    StatsThread& operator=(const StatsThread&) = delete;
+
+    static StatsThread& local() {
+        thread_local StatsThread self;
+        return self;
+    }
+    // Only the owning thread writes, so a plain load and store suffice
+    static void bump(std::atomic<uint64_t>& a, uint64_t n) {
+        a.store(a.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+    void record(StatOp op, uint64_t ns);
+};
+
+// Only the outermost timer on a thread records, so an operation built on
+// others (a polygon ray cast testing each edge, say) counts as one call of
+// itself and the inner ones do not read the clock at all
+class StatTimer {
+    StatsThread& thread;
+    StatOp op;
+    bool outer;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit StatTimer(StatOp o) : thread(StatsThread::local()), op(o), outer(thread.depth++ == 0) {
+        if (outer) start = std::chrono::steady_clock::now();
+    }
+    ~StatTimer() {
+        --thread.depth;
+        if (!outer) return;
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        thread.record(op, static_cast<uint64_t>(ns.count()));
+    }
+    StatTimer(const StatTimer&) = delete;
+    StatTimer& operator=(const StatTimer&) = delete;
+};
+
+#define COMPGEO_STATS_CAT2(a, b) a##b
+#define COMPGEO_STATS_CAT(a, b) COMPGEO_STATS_CAT2(a, b)
+#define COMPGEO_COUNT(counter) COMPGEO_COUNT_N(counter, 1)
+#define COMPGEO_COUNT_N(counter, n) \
+    StatsThread::bump(StatsThread::local().counters[static_cast<size_t>(StatCounter::counter)], (n))
+// Times the rest of the enclosing scope
+#define COMPGEO_TIME(op) StatTimer COMPGEO_STATS_CAT(compgeo_timer_, __LINE__)(StatOp::op)
+
+#else
+
+#define COMPGEO_COUNT(counter) ((void)0)
+#define COMPGEO_COUNT_N(counter, n) ((void)0)
+#define COMPGEO_TIME(op) ((void)0)
+
+#endif
+
+#include "Stats.ipp"
+
+#endif // STATS_H
@@ -0,0 +1,164 @@
+#ifndef STATS_IPP
+#define STATS_IPP
+
+#include "Stats.h"
+#include <algorithm>
+#include <bit>
+
+inline const char* stat_name(StatCounter c) {
+    switch (c) {
+        case StatCounter::EdgesTested: return "edges_tested";
+        case StatCounter::ParallelRejects: return "parallel_rejects";
+        case StatCounter::CollinearRejects: return "collinear_rejects";
+        case StatCounter::DegenerateRejects: return "degenerate_rejects";
+        case StatCounter::EarlyExits: return "early_exits";
+        default: return "unknown";
+    }
+}
+
+inline const char* stat_name(StatOp op) {
+    switch (op) {
+        case StatOp::RayIntersectRay: return "ray_intersect_ray";
+        case StatOp::RayIntersectSegment: return "ray_intersect_segment";
+        case StatOp::RayIntersectPolygon: return "ray_intersect_polygon";
+        case StatOp::PolygonContains: return "polygon_contains";
+        case StatOp::PolygonIntersectSegment: return "polygon_intersect_segment";
+        case StatOp::PolygonIntersectPolygon: return "polygon_intersect_polygon";
+        default: return "unknown";
+    }
+}
+
+inline uint64_t StatsSnapshot::Latency::percentile_ns(double q) const {
+    if (calls == 0) return 0;
+    const double rank = std::clamp(q, 0.0, 1.0) * double(calls);
+    uint64_t seen = 0;
+    for (size_t k = 0; k < stat_buckets; ++k) {
+        seen += buckets[k];
+        if (seen > 0 && double(seen) >= rank) return uint64_t(1) << (k + 1);
+    }
+    return uint64_t(1) << stat_buckets;
+}
+
+inline std::string StatsSnapshot::json() const {
+    std::string s = "{\"enabled\": ";
+    s += enabled ? "true" : "false";
+    s += ", \"counters\": {";
+    for (size_t c = 0; c < stat_counter_count; ++c) {
+        if (c) s += ", ";
+        s += "\"";
+        s += stat_name(static_cast<StatCounter>(c));
+        s += "\": " + std::to_string(counters[c]);
+    }
+    s += "}, \"operations\": {";
+    for (size_t o = 0; o < stat_op_count; ++o) {
+        const Latency& l = ops[o];
+        if (o) s += ", ";
+        s += "\"";
+        s += stat_name(static_cast<StatOp>(o));
+        s += "\": {\"calls\": " + std::to_string(l.calls) + ", \"total_ns\": " + std::to_string(l.total_ns) +
+             ", \"mean_ns\": " + std::to_string(uint64_t(l.mean_ns() + 0.5)) +
+             ", \"p50_ns\": " + std::to_string(l.percentile_ns(0.5)) +
+             ", \"p90_ns\": " + std::to_string(l.percentile_ns(0.9)) +
+             ", \"p99_ns\": " + std::to_string(l.percentile_ns(0.99)) + ", \"histogram\": [";
+        // Trailing empty buckets are left out
+        size_t last = stat_buckets;
+        while (last > 0 && l.buckets[last - 1] == 0) --last;
+        for (size_t k = 0; k < last; ++k) {
+            if (k) s += ", ";
+            s += std::to_string(l.buckets[k]);
+        }
+        s += "]}";
+    }
+    s += "}}";
+    return s;
+}
+
+#ifdef COMPGEO_ENABLE_STATS
+
+#include <mutex>
+#include <vector>
+
+// Live per-thread blocks, the totals of threads that have exited, and the
+// baseline taken by the last reset
+struct StatsRegistry {
+    std::mutex mutex;
+    std::vector<const StatsThread*> live;
+    StatsSnapshot retired;
+    StatsSnapshot baseline;
+
+    static StatsRegistry& get() {
+        // Never destroyed, so threads exiting after main() can still retire
+        static StatsRegistry* registry = new StatsRegistry;
+        return *registry;
+    }
+
+    static void accumulate(StatsSnapshot& into, const StatsThread& t) {
+        for (size_t c = 0; c < stat_counter_count; ++c)
+            into.counters[c] += t.counters[c].load(std::memory_order_relaxed);
+        for (size_t o = 0; o < stat_op_count; ++o) {
+            into.ops[o].calls += t.calls[o].load(std::memory_order_relaxed);
+            into.ops[o].total_ns += t.total_ns[o].load(std::memory_order_relaxed);
+            for (size_t k = 0; k < stat_buckets; ++k)
+                into.ops[o].buckets[k] += t.buckets[o][k].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Caller holds the mutex
+    StatsSnapshot total() const {
+        StatsSnapshot s = retired;
+        for (const StatsThread* t : live) accumulate(s, *t);
+        return s;
+    }
+};
+
+inline StatsThread::StatsThread() {
+    StatsRegistry& r = StatsRegistry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.live.push_back(this);
+}
+
+inline StatsThread::~StatsThread() {
+    StatsRegistry& r = StatsRegistry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    StatsRegistry::accumulate(r.retired, *this);
+    r.live.erase(std::find(r.live.begin(), r.live.end(), this));
+}
+
+inline void StatsThread::record(StatOp op, uint64_t ns) {
+    const size_t o = static_cast<size_t>(op);
+    const size_t k = std::min<size_t>(ns > 1 ? std::bit_width(ns) - 1 : 0, stat_buckets - 1);
+    bump(calls[o], 1);
+    bump(total_ns[o], ns);
+    bump(buckets[o][k], 1);
+}
+
+inline StatsSnapshot stats_snapshot() {
+    StatsRegistry& r = StatsRegistry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    StatsSnapshot s = r.total();
+    s.enabled = true;
+    for (size_t c = 0; c < stat_counter_count; ++c) s.counters[c] -= r.baseline.counters[c];
+    for (size_t o = 0; o < stat_op_count; ++o) {
+        s.ops[o].calls -= r.baseline.ops[o].calls;
+        s.ops[o].total_ns -= r.baseline.ops[o].total_ns;
+        for (size_t k = 0; k < stat_buckets; ++k) s.ops[o].buckets[k] -= r.baseline.ops[o].buckets[k];
+    }
+    return s;
+}
+
+inline void stats_reset() {
+    StatsRegistry& r = StatsRegistry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    // Counters are never cleared in place, as that would race with their
+    // owning threads; later snapshots subtract this baseline instead
+    r.baseline = r.total();
+}
+
+#else
+
+inline StatsSnapshot stats_snapshot() { return {}; }
+inline void stats_reset() {}
+
+#endif
+
+#endif // STATS_IPP
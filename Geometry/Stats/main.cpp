@@ -0,0 +1,126 @@
+// Build once plain and once with -DCOMPGEO_ENABLE_STATS: the plain build
+// must report nothing, the instrumented one exact counts, and the benchmark
+// lines of the two show what the instrumentation costs.
+#include "Stats.h"
+#include "../Ray/Ray.h"
+#include "../Polygon/Polygon.h"
+#include "../Batch/ThreadPool.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <string>
+
+using ns = std::chrono::duration<double, std::nano>;
+using P = Point<2, float>;
+
+static Polygon<2, float> star(size_t n, float cx, float cy) {
+    std::vector<P> pts;
+    for (size_t i = 0; i < n; ++i) {
+        float a = 2 * float(M_PI) * i / n, r = i % 2 ? 1.0f : 0.4f;
+        pts.push_back(P{cx + r * std::cos(a), cy + r * std::sin(a)});
+    }
+    return Polygon<2, float>(pts);
+}
+
+int main(int argc, char** argv) {
+#ifdef COMPGEO_ENABLE_STATS
+    const bool enabled = true;
+#else
+    const bool enabled = false;
+#endif
+    std::cout << "=== HOT-PATH STATISTICS (" << (enabled ? "enabled" : "compiled out") << ") ===\n";
+
+    // A mixed workload: containment, segment and ray queries on stars
+    const size_t queries = 200000;
+    std::minstd_rand rng(7);
+    std::uniform_real_distribution<float> pos(-1.2f, 1.2f);
+    std::vector<P> probes(queries);
+    for (auto& p : probes) p = P{pos(rng), pos(rng)};
+    auto shape = star(64, 0, 0);
+    shape.area();
+
+    stats_reset();
+    auto t0 = std::chrono::steady_clock::now();
+    size_t inside = 0, crossed = 0, hit = 0;
+    for (size_t i = 0; i < queries; ++i) {
+        const P& p = probes[i];
+        inside += shape.isInside(p);
+        crossed += shape.intersect(LineSegment<2, float>(p, P{p.dx() + 0.3f, p.dy() - 0.2f}));
+        hit += bool(Ray<2, float>(p, Vector<2, float>{1, 0.25f}).intersect(shape));
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    std::cout << "Inside " << inside << ", crossed " << crossed << ", hit " << hit << " of " << queries << "\n";
+    std::cout << "Mixed query: " << ns(t1 - t0).count() / queries << " ns\n";
+    StatsSnapshot workload = stats_snapshot();
+    std::cout << workload.json() << "\n";
+
+    std::cout << "\n[TEST] Snapshot reports whether statistics are compiled in: ";
+    bool ok = workload.enabled == enabled &&
+              workload.json().rfind(enabled ? "{\"enabled\": true" : "{\"enabled\": false", 0) == 0;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Calls and edges match the workload: ";
+    if (enabled) {
+        ok = workload[StatOp::PolygonContains].calls == queries &&
+             workload[StatOp::PolygonIntersectSegment].calls == queries &&
+             workload[StatOp::RayIntersectPolygon].calls == queries &&
+             workload[StatOp::RayIntersectSegment].calls == 0 &&   // nested in the ray casts
+             workload[StatCounter::EarlyExits] == crossed &&
+             workload[StatCounter::EdgesTested] > 2 * 64 * queries &&
+             workload[StatCounter::EdgesTested] <= 3 * 64 * queries;
+        uint64_t binned = 0;
+        for (uint64_t b : workload[StatOp::PolygonContains].buckets) binned += b;
+        ok = ok && binned == queries && workload[StatOp::PolygonContains].percentile_ns(0.5) > 0;
+    } else {
+        ok = workload[StatCounter::EdgesTested] == 0 && workload[StatOp::PolygonContains].calls == 0;
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Rejections and early exits are counted exactly: ";
+    stats_reset();
+    Ray<2, float> ray(P{0, 0}, Vector<2, float>{1, 0});
+    ray.intersect(Ray<2, float>(P{0, 1}, Vector<2, float>{-2, 0}));                 // parallel
+    ray.intersect(LineSegment<2, float>(P{2, 2}, P{2, 2}));                         // degenerate
+    LineSegment<2, float>(P{0, 0}, P{1, 1}).intersect(LineSegment<2, float>(P{2, 2}, P{3, 3}));   // collinear
+    Polygon<2, float> square{P{0, 0}, P{4, 0}, P{4, 4}, P{0, 4}};
+    square.intersect(LineSegment<2, float>(P{2, 2}, P{5, 2}));                      // exits at edge 2
+    square.intersect(LineSegment<2, float>(P{1, 1}, P{2, 2}));                      // all 4 edges
+    StatsSnapshot small = stats_snapshot();
+    if (enabled) {
+        ok = small[StatCounter::ParallelRejects] == 1 && small[StatCounter::DegenerateRejects] == 1 &&
+             small[StatCounter::CollinearRejects] == 1 && small[StatCounter::EarlyExits] == 1 &&
+             small[StatCounter::EdgesTested] == 6 && small[StatOp::RayIntersectRay].calls == 1 &&
+             small[StatOp::RayIntersectSegment].calls == 1 && small[StatOp::PolygonIntersectSegment].calls == 2;
+    } else {
+        ok = small[StatCounter::ParallelRejects] == 0 && small[StatOp::RayIntersectRay].calls == 0;
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    // Each worker counts into its own block; totals survive the pool
+    const size_t threads = argc > 1 ? std::stoul(argv[1]) : 4;
+    const size_t jobs = 100000;
+    stats_reset();
+    {
+        ThreadPool pool(threads);
+        std::vector<uint8_t> out(jobs);
+        pool.parallel_for(jobs, 256, [&](size_t b, size_t e) {
+            for (size_t i = b; i < e; ++i) out[i] = square.isInside(probes[i % queries]);
+        });
+    }
+    StatsSnapshot mt = stats_snapshot();
+    std::cout << "[TEST] Counts from " << threads << " threads add up after they exit: ";
+    ok = enabled ? mt[StatOp::PolygonContains].calls == jobs && mt[StatCounter::EdgesTested] == 4 * jobs
+                 : mt[StatOp::PolygonContains].calls == 0;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Reset starts a new window: ";
+    stats_reset();
+    square.isInside(P{1, 1});
+    StatsSnapshot after = stats_snapshot();
+    ok = after[StatOp::PolygonContains].calls == (enabled ? 1u : 0u) &&
+         after[StatCounter::EdgesTested] == (enabled ? 4u : 0u) && after[StatCounter::EarlyExits] == 0;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+    return 0;
+}
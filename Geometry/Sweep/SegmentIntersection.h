@@ -0,0 +1,80 @@
+#ifndef SEGMENT_INTERSECTION_H
+#define SEGMENT_INTERSECTION_H
+
+#include "../Point/Point.h"
+#include "../Ray/LineSegment.h"
+#include <vector>
+#include <map>
+#include <set>
+#include <cstdint>
+
+template <size_t D, typename T>
+struct SegmentIntersection {
+    size_t first, second;   // input indices, first < second
+    Point<D, T> point;
+};
+
+// Bentley–Ottmann sweep over 2D segments. Reports every pair of segments that
+// meet at an event point, in O((n + k) log n). Arithmetic is done in double
+// whatever T is.
+template <size_t D, typename T>
+class SegmentSweep {
+    static_assert(D == 2, "SegmentSweep is 2D only for this version.");
+
+    struct Seg {
+        double ax, ay, bx, by;   // (ax, ay) is the lexicographically smaller end
+        size_t id;
+    };
+    struct Probe { double y; };
+    struct EventPoint {
+        double x, y;
+        bool operator<(const EventPoint& o) const { return x < o.x || (x == o.x && y < o.y); }
+    };
+    struct Event {
+        std::vector<uint32_t> starts, ends;
+    };
+    struct Order {
+        const SegmentSweep* sweep;
+        using is_transparent = void;
+        bool operator()(uint32_t a, uint32_t b) const { return sweep->below(a, b); }
+        bool operator()(uint32_t a, Probe p) const { return sweep->y_at(a) < p.y; }
+        bool operator()(Probe p, uint32_t a) const { return p.y < sweep->y_at(a); }
+    };
+
+    std::vector<Seg> segs;
+    std::map<EventPoint, Event> queue;
+    std::set<uint32_t, Order> status{Order{this}};
+    std::vector<uint64_t> through;   // epoch at which a segment last passed the sweep point
+    EventPoint sweep_point{0, 0};
+    uint64_t epoch = 0;
+    double tolerance = 0;
+
+    double y_at(uint32_t s) const;
+    double slope(uint32_t s) const;
+    bool below(uint32_t a, uint32_t b) const;
+    void schedule(uint32_t a, uint32_t b);
+
+public:
+    explicit SegmentSweep(const std::vector<LineSegment<2, T>>& input);
+    SegmentSweep(const SegmentSweep&) = delete;
+    SegmentSweep& operator=(const SegmentSweep&) = delete;
+
+    // Calls report(i, j, point) for each pair meeting at an event point, where
+    // i, j are input indices. Collinear overlapping pairs are reported too and
+    // are left to the caller to filter. Stops early when report returns true.
+    template <typename Report>
+    void run(Report&& report);
+};
+
+// All proper intersections, matching LineSegment::intersect (parallel and
+// collinear pairs are not reported).
+template <size_t D, typename T>
+std::vector<SegmentIntersection<D, T>> find_intersections(const std::vector<LineSegment<D, T>>& segs);
+
+// True when any two segments intersect; stops at the first one found.
+template <size_t D, typename T>
+bool any_intersection(const std::vector<LineSegment<D, T>>& segs);
+
+#include "SegmentIntersection.ipp"
+
+#endif // SEGMENT_INTERSECTION_H
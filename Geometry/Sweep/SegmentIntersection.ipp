@@ -0,0 +1,181 @@
+#ifndef SEGMENT_INTERSECTION_IPP
+#define SEGMENT_INTERSECTION_IPP
+
+#include "SegmentIntersection.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+template <size_t D, typename T>
+SegmentSweep<D, T>::SegmentSweep(const std::vector<LineSegment<2, T>>& input) {
+    if (input.size() > std::numeric_limits<uint32_t>::max())
+        throw std::length_error("Too many segments for SegmentSweep");
+
+    double scale = 1;
+    for (size_t i = 0; i < input.size(); ++i) {
+        Seg s{double(input[i].a.dx()), double(input[i].a.dy()),
+              double(input[i].b.dx()), double(input[i].b.dy()), i};
+        // zero-length segments never intersect anything (as in LineSegment::intersect)
+        if (s.ax == s.bx && s.ay == s.by) continue;
+        if (s.bx < s.ax || (s.bx == s.ax && s.by < s.ay)) {
+            std::swap(s.ax, s.bx);
+            std::swap(s.ay, s.by);
+        }
+        scale = std::max({scale, std::abs(s.ax), std::abs(s.ay), std::abs(s.bx), std::abs(s.by)});
+        uint32_t idx = static_cast<uint32_t>(segs.size());
+        segs.push_back(s);
+        queue[EventPoint{s.ax, s.ay}].starts.push_back(idx);
+        queue[EventPoint{s.bx, s.by}].ends.push_back(idx);
+    }
+    through.assign(segs.size(), 0);
+    tolerance = scale * 1e-12;
+}
+
+template <size_t D, typename T>
+double SegmentSweep<D, T>::y_at(uint32_t s) const {
+    if (through[s] == epoch) return sweep_point.y;
+    const Seg& g = segs[s];
+    if (g.ax == g.bx) return std::clamp(sweep_point.y, g.ay, g.by);
+    if (sweep_point.x <= g.ax) return g.ay;
+    if (sweep_point.x >= g.bx) return g.by;
+    return g.ay + (sweep_point.x - g.ax) * (g.by - g.ay) / (g.bx - g.ax);
+}
+
+template <size_t D, typename T>
+double SegmentSweep<D, T>::slope(uint32_t s) const {
+    const Seg& g = segs[s];
+    if (g.ax == g.bx) return std::numeric_limits<double>::infinity();
+    return (g.by - g.ay) / (g.bx - g.ax);
+}
+
+// Order along the sweep line just to the right of the sweep point: by height,
+// then by slope for segments meeting there, then by index for overlaps. Two
+// segments meeting higher up the sweep point's column have not crossed yet,
+// because that event comes later, so they keep the opposite slope order.
+template <size_t D, typename T>
+bool SegmentSweep<D, T>::below(uint32_t a, uint32_t b) const {
+    if (a == b) return false;
+    double ya = y_at(a), yb = y_at(b);
+    if (ya != yb) return ya < yb;
+    double sa = slope(a), sb = slope(b);
+    if (sa != sb) return ya > sweep_point.y ? sa > sb : sa < sb;
+    return a < b;
+}
+
+// Queues the crossing of a and b if it lies strictly after the sweep point.
+template <size_t D, typename T>
+void SegmentSweep<D, T>::schedule(uint32_t a, uint32_t b) {
+    if (a > b) std::swap(a, b);   // same pair, same rounding, whichever side it is on
+    const Seg& s1 = segs[a];
+    const Seg& s2 = segs[b];
+    double d1x = s1.bx - s1.ax, d1y = s1.by - s1.ay;
+    double d2x = s2.bx - s2.ax, d2y = s2.by - s2.ay;
+    double wx = s2.ax - s1.ax, wy = s2.ay - s1.ay;
+
+    double denom = d1x * d2y - d1y * d2x;
+    if (denom == 0) return;   // parallel; overlaps surface at shared endpoints
+    double t = (wx * d2y - wy * d2x) / denom;
+    double s = (wx * d1y - wy * d1x) / denom;
+    if (t < 0 || t > 1 || s < 0 || s > 1) return;
+
+    // keep the rounded point inside both boxes: on a vertical or horizontal
+    // segment it then lies exactly on its line, and cannot be ordered after
+    // the segment's own end event
+    const double lo_x = std::max(s1.ax, s2.ax), hi_x = std::min(s1.bx, s2.bx);
+    const double lo_y = std::max(std::min(s1.ay, s1.by), std::min(s2.ay, s2.by));
+    const double hi_y = std::min(std::max(s1.ay, s1.by), std::max(s2.ay, s2.by));
+    if (lo_x > hi_x || lo_y > hi_y) return;
+    EventPoint q{std::clamp(s1.ax + t * d1x, lo_x, hi_x), std::clamp(s1.ay + t * d1y, lo_y, hi_y)};
+    // a crossing within tolerance of p or of a queued event is the same event;
+    // this also snaps T-junctions onto the endpoint event
+    if (std::abs(q.x - sweep_point.x) <= tolerance && std::abs(q.y - sweep_point.y) <= tolerance) return;
+    // Otherwise it joins the column of p or of a queued event within
+    // tolerance, so it is ordered exactly against the events of a vertical
+    // segment there. Queued x values within tolerance are few, however many
+    // events share each one, so look up the nearest y in each column rather
+    // than scanning the column.
+    const double x0 = q.x;
+    bool snapped = std::abs(x0 - sweep_point.x) <= tolerance;
+    if (snapped) q.x = sweep_point.x;
+    const double lowest = std::numeric_limits<double>::lowest(), highest = std::numeric_limits<double>::infinity();
+    auto it = queue.lower_bound(EventPoint{x0 - tolerance, lowest});
+    while (it != queue.end() && it->first.x <= x0 + tolerance) {
+        const double x = it->first.x;
+        auto near = queue.lower_bound(EventPoint{x, q.y - tolerance});
+        if (near != queue.end() && near->first.x == x && near->first.y <= q.y + tolerance) return;
+        if (!snapped) { q.x = x; snapped = true; }
+        it = queue.upper_bound(EventPoint{x, highest});
+    }
+    if (!(sweep_point < q)) return;
+    queue.try_emplace(q);
+}
+
+template <size_t D, typename T>
+template <typename Report>
+void SegmentSweep<D, T>::run(Report&& report) {
+    std::vector<uint32_t> meeting, keep;
+    while (!queue.empty()) {
+        auto node = queue.extract(queue.begin());
+        const EventPoint p = node.key();
+        const Event& ev = node.mapped();
+        sweep_point = p;
+        ++epoch;
+
+        // segments already on the sweep line that pass through p
+        auto lo = status.lower_bound(Probe{p.y - tolerance});
+        auto hi = status.upper_bound(Probe{p.y + tolerance});
+        meeting.assign(lo, hi);
+        status.erase(lo, hi);
+
+        keep.clear();
+        for (uint32_t s : meeting)
+            if (std::find(ev.ends.begin(), ev.ends.end(), s) == ev.ends.end()) keep.push_back(s);
+        meeting.insert(meeting.end(), ev.starts.begin(), ev.starts.end());
+        keep.insert(keep.end(), ev.starts.begin(), ev.starts.end());
+
+        for (size_t i = 0; i < meeting.size(); ++i)
+            for (size_t j = i + 1; j < meeting.size(); ++j) {
+                size_t a = segs[meeting[i]].id, b = segs[meeting[j]].id;
+                if (report(std::min(a, b), std::max(a, b), Point<2, T>{T(p.x), T(p.y)})) return;
+            }
+
+        // reinsert the continuing segments in their order just after p
+        for (uint32_t s : keep) through[s] = epoch;
+        for (uint32_t s : keep) status.insert(s);
+
+        if (keep.empty()) {
+            auto up = status.lower_bound(Probe{p.y});
+            if (up != status.begin() && up != status.end()) schedule(*std::prev(up), *up);
+        } else {
+            auto first = status.lower_bound(Probe{p.y});
+            auto last = std::prev(status.upper_bound(Probe{p.y}));
+            if (first != status.begin()) schedule(*std::prev(first), *first);
+            if (std::next(last) != status.end()) schedule(*last, *std::next(last));
+        }
+    }
+}
+
+template <size_t D, typename T>
+std::vector<SegmentIntersection<D, T>> find_intersections(const std::vector<LineSegment<D, T>>& segs) {
+    std::vector<SegmentIntersection<D, T>> out;
+    SegmentSweep<D, T> sweep(segs);
+    sweep.run([&](size_t i, size_t j, const Point<D, T>& p) {
+        if (!segs[i].collinear(segs[j])) out.push_back({i, j, p});
+        return false;
+    });
+    return out;
+}
+
+template <size_t D, typename T>
+bool any_intersection(const std::vector<LineSegment<D, T>>& segs) {
+    bool found = false;
+    SegmentSweep<D, T> sweep(segs);
+    sweep.run([&](size_t i, size_t j, const Point<D, T>&) {
+        found = !segs[i].collinear(segs[j]);
+        return found;
+    });
+    return found;
+}
+
+#endif // SEGMENT_INTERSECTION_IPP
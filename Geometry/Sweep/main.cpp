@@ -0,0 +1,155 @@
+#include "SegmentIntersection.h"
+#include "../Polygon/Polygon.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <utility>
+
+using Seg = LineSegment<2, double>;
+
+static std::vector<Seg> random_segments(size_t n, double len, std::mt19937& rng) {
+    std::uniform_real_distribution<double> pos(0.0, 1000.0), off(-len, len);
+    std::vector<Seg> segs;
+    for (size_t i = 0; i < n; ++i) {
+        Point<2, double> a{pos(rng), pos(rng)};
+        segs.emplace_back(a, Point<2, double>{a[0] + off(rng), a[1] + off(rng)});
+    }
+    return segs;
+}
+
+// The pairwise reference: every pair through LineSegment::intersect
+static std::vector<std::pair<size_t, size_t>> pairwise(const std::vector<Seg>& segs) {
+    std::vector<std::pair<size_t, size_t>> out;
+    for (size_t i = 0; i < segs.size(); ++i)
+        for (size_t j = i + 1; j < segs.size(); ++j)
+            if (segs[i].intersect(segs[j])) out.emplace_back(i, j);
+    return out;
+}
+
+static bool pairwise_simple(const Polygon<2, double>& poly) {
+    size_t n = poly.size();
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = i + 2; j < n; ++j) {
+            if (i == 0 && j == n - 1) continue;
+            Seg e1(poly[i], poly[(i + 1) % n]), e2(poly[j], poly[(j + 1) % n]);
+            if (e1.intersect(e2)) return false;
+        }
+    return true;
+}
+
+int main() {
+    std::vector<Seg> cross = {
+        Seg(Point<2, double>{0, 0}, Point<2, double>{4, 4}),
+        Seg(Point<2, double>{0, 4}, Point<2, double>{4, 0}),
+        Seg(Point<2, double>{2, 0}, Point<2, double>{2, 4}),
+        Seg(Point<2, double>{5, 0}, Point<2, double>{6, 1})
+    };
+    std::cout << "Intersections:\n";
+    for (const auto& x : find_intersections(cross))
+        std::cout << "  " << x.first << " x " << x.second << " at " << x.point << "\n";
+
+    Polygon<2, double> square({
+        Point<2, double>{0, 0}, Point<2, double>{2, 0},
+        Point<2, double>{2, 2}, Point<2, double>{0, 2}
+    });
+    Polygon<2, double> bowtie({
+        Point<2, double>{0, 0}, Point<2, double>{2, 2},
+        Point<2, double>{2, 0}, Point<2, double>{0, 2}
+    });
+    std::cout << "Square simple: " << (square.is_simple() ? "YES" : "NO") << "\n";
+    std::cout << "Bowtie simple: " << (bowtie.is_simple() ? "YES" : "NO") << "\n";
+
+    std::cout << "\n=== SWEEP vs PAIRWISE ===\n\n";
+
+    std::mt19937 rng(99);
+    using ms = std::chrono::duration<double, std::milli>;
+
+    for (size_t n : {1000u, 10000u, 100000u}) {
+        auto segs = random_segments(n, 6.0, rng);
+
+        auto t0 = std::chrono::steady_clock::now();
+        auto found = find_intersections(segs);
+        auto t1 = std::chrono::steady_clock::now();
+
+        std::cout << "Segments: " << n << ", intersections: " << found.size() << "\n";
+        std::cout << "  sweep:    " << ms(t1 - t0).count() << " ms\n";
+        if (n > 10000) continue;   // the O(n^2) reference is too slow beyond this
+
+        auto t2 = std::chrono::steady_clock::now();
+        auto ref = pairwise(segs);
+        auto t3 = std::chrono::steady_clock::now();
+        std::cout << "  pairwise: " << ms(t3 - t2).count() << " ms\n";
+
+        std::vector<std::pair<size_t, size_t>> got;
+        for (const auto& x : found) got.emplace_back(x.first, x.second);
+        std::sort(got.begin(), got.end());
+        std::cout << "  [TEST] sweep matches pairwise: " << (got == ref ? "PASS" : "FAIL") << "\n";
+    }
+
+    // Axis-aligned: rungs y = i across x in [0, 1], posts on x = 0.5 crossing
+    // one rung each. Every post end and crossing shares one x, which made
+    // event deduplication scan the whole column.
+    std::cout << "\n=== AXIS-ALIGNED LADDER ===\n\n";
+    bool ladder_ok = true;
+    for (size_t n : {2000u, 20000u, 80000u}) {
+        std::vector<Seg> segs;
+        for (size_t i = 0; i < n / 2; ++i) {
+            segs.emplace_back(Point<2, double>{0, double(i)}, Point<2, double>{1, double(i)});
+            segs.emplace_back(Point<2, double>{0.5, i - 0.25}, Point<2, double>{0.5, i + 0.25});
+        }
+        auto t0 = std::chrono::steady_clock::now();
+        auto found = find_intersections(segs);
+        auto t1 = std::chrono::steady_clock::now();
+        std::cout << "Segments: " << n << ", intersections: " << found.size() << ", sweep: "
+                  << ms(t1 - t0).count() << " ms\n";
+        ladder_ok = ladder_ok && found.size() == n / 2;
+        if (n == 2000) {
+            std::vector<std::pair<size_t, size_t>> got;
+            for (const auto& x : found) got.emplace_back(x.first, x.second);
+            std::sort(got.begin(), got.end());
+            ladder_ok = ladder_ok && got == pairwise(segs);
+        }
+    }
+    std::cout << "[TEST] Ladder crossings all found once: " << (ladder_ok ? "PASS" : "FAIL") << "\n";
+
+    // Integer endpoints, two thirds of them on vertical or horizontal
+    // segments: crossings land exactly on a vertical's column, or round to
+    // just beside it, and several segments often meet in one point
+    std::cout << "[TEST] Grid segments with vertical and horizontal runs: every crossing found: ";
+    size_t missed = 0;
+    for (int trial = 0; trial < 400; ++trial) {
+        const int span = trial % 2 ? 10 : 1000;
+        std::uniform_int_distribution<int> grid(-span, span);
+        std::vector<Seg> segs;
+        for (int k = 0; k < 60; ++k) {
+            Point<2, double> a{double(grid(rng)), double(grid(rng))}, b{double(grid(rng)), double(grid(rng))};
+            if (k % 3 == 0) b = Point<2, double>{a[0], b[1]};
+            if (k % 3 == 1) b = Point<2, double>{b[0], a[1]};
+            segs.emplace_back(a, b);
+        }
+        std::vector<std::pair<size_t, size_t>> got;
+        for (const auto& x : find_intersections(segs)) got.emplace_back(x.first, x.second);
+        std::sort(got.begin(), got.end());
+        for (const auto& pr : pairwise(segs))
+            missed += !segs[pr.first].collinear(segs[pr.second]) && !std::binary_search(got.begin(), got.end(), pr);
+    }
+    std::cout << (missed == 0 ? "PASS" : "FAIL") << " (" << missed << " missed)\n";
+
+    std::cout << "\n=== is_simple vs PAIRWISE ===\n\n";
+
+    size_t mismatches = 0, simple = 0;
+    std::uniform_real_distribution<double> pos(0.0, 10.0);
+    for (int trial = 0; trial < 2000; ++trial) {
+        std::vector<Point<2, double>> pts;
+        for (int k = 0; k < 3 + trial % 8; ++k) pts.push_back(Point<2, double>{pos(rng), pos(rng)});
+        Polygon<2, double> poly(pts);
+        bool fast = poly.is_simple();
+        simple += fast;
+        if (fast != pairwise_simple(poly)) ++mismatches;
+    }
+    std::cout << "[TEST] is_simple matches pairwise on 2000 random polygons (" << simple
+              << " simple): " << (mismatches == 0 ? "PASS" : "FAIL") << "\n";
+
+    return 0;
+}
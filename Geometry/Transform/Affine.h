@@ -0,0 +1,88 @@
+#ifndef AFFINE_H
+#define AFFINE_H
+
+#include "../Point/Point.h"
+#include "../Vector/Vector_new.h"
+#include "../Ray/Ray.h"
+#include "../Polygon/Polygon.h"
+#include "../SoA/PointSoA.h"
+#include "../SoA/VectorSoA.h"
+#include <array>
+#include <span>
+#include <utility>
+
+// Affine map of D-space, stored as the top D rows of the homogeneous
+// (D+1)x(D+1) matrix, row-major: [linear part | translation]. The last row
+// (0 ... 0 1) is implicit. Chains are composed once with operator* and then
+// applied to whole buffers through the SoA kernels.
+template <size_t D, typename T>
+class Affine {
+    static_assert(D == 2 || D == 3, "Affine supports only 2D or 3D.");
+    static_assert(std::is_floating_point_v<T>, "Affine needs floating-point coordinates");
+
+    std::array<T, D * (D + 1)> m;
+
+public:
+    // The identity
+    constexpr Affine() noexcept;
+    constexpr explicit Affine(const std::array<T, D * (D + 1)>& rows) noexcept : m(rows) {}
+
+    static constexpr Affine identity() noexcept { return Affine(); }
+    static constexpr Affine translation(const Vector<D, T>& v) noexcept;
+    static constexpr Affine scaling(T s) noexcept;
+    static constexpr Affine scaling(const Vector<D, T>& s) noexcept;
+    // 2D rotation by the angle with the given cosine and sine
+    static constexpr Affine rotation(T cos_a, T sin_a) noexcept;
+    // 2D rotation, counter-clockwise by `angle` radians
+    static Affine rotation(T angle);
+    // 3D rotation by `angle` radians about `axis`, right-handed
+    static Affine rotation(const Vector<3, T>& axis, T angle);
+    // `a` carried out around `pivot` instead of the origin
+    static constexpr Affine about(const Point<D, T>& pivot, const Affine& a) noexcept;
+
+    // Entry of the homogeneous matrix; row D is (0 ... 0 1)
+    constexpr T operator()(size_t row, size_t col) const noexcept;
+    constexpr const T* data() const noexcept { return m.data(); }
+
+    // (a * b) applies b first, then a
+    constexpr Affine operator*(const Affine& other) const noexcept;
+    // This map followed by `next`
+    constexpr Affine then(const Affine& next) const noexcept { return next * *this; }
+    constexpr bool operator==(const Affine& other) const noexcept { return m == other.m; }
+    constexpr bool operator!=(const Affine& other) const noexcept { return m != other.m; }
+
+    // Determinant of the linear part: the factor areas (volumes) scale by
+    constexpr T determinant() const noexcept;
+    // Throws std::runtime_error if the map is singular
+    constexpr Affine inverse() const;
+
+    constexpr Point<D, T> apply(const Point<D, T>& p) const noexcept;
+    // Vectors are displacements and ignore the translation
+    constexpr Vector<D, T> apply(const Vector<D, T>& v) const noexcept;
+    Ray<D, T> apply(const Ray<D, T>& r) const;
+
+    // In place over whole buffers
+    void apply(std::span<Point<D, T>> pts) const;
+    void apply(std::span<Vector<D, T>> vs) const;
+    void apply(std::span<Ray<D, T>> rays) const;
+    void apply(PointSoA<D, T>& pts) const;
+    void apply(VectorSoA<D, T>& vs) const;
+    void apply(Polygon<2, T>& poly) const { poly.transform(*this); }
+
+    // Maps pts in place and returns their bounding box from the same pass.
+    // Throws std::invalid_argument if pts is empty.
+    std::pair<Point<D, T>, Point<D, T>> apply_bounds(std::span<Point<D, T>> pts) const;
+
+    friend std::ostream& operator<<(std::ostream& os, const Affine& a) {
+        os << "Affine[";
+        for (size_t r = 0; r < D; ++r) {
+            for (size_t c = 0; c <= D; ++c) os << a(r, c) << (c < D ? " " : "");
+            if (r + 1 < D) os << "; ";
+        }
+        return os << "]";
+    }
+};
+
+#include "Affine.ipp"
+
+#endif // AFFINE_H
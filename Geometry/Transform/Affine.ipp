@@ -0,0 +1,226 @@
+#ifndef AFFINE_IPP
+#define AFFINE_IPP
+
+#include "Affine.h"
+#include "../SoA/SoAKernels.h"
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+template <size_t D, typename T>
+constexpr Affine<D, T>::Affine() noexcept : m{} {
+    for (size_t i = 0; i < D; ++i) m[i * (D + 1) + i] = 1;
+}
+
+template <size_t D, typename T>
+constexpr Affine<D, T> Affine<D, T>::translation(const Vector<D, T>& v) noexcept {
+    Affine a;
+    for (size_t i = 0; i < D; ++i) a.m[i * (D + 1) + D] = v.get(i);
+    return a;
+}
+
+template <size_t D, typename T>
+constexpr Affine<D, T> Affine<D, T>::scaling(T s) noexcept {
+    Affine a;
+    for (size_t i = 0; i < D; ++i) a.m[i * (D + 1) + i] = s;
+    return a;
+}
+
+template <size_t D, typename T>
+constexpr Affine<D, T> Affine<D, T>::scaling(const Vector<D, T>& s) noexcept {
+    Affine a;
+    for (size_t i = 0; i < D; ++i) a.m[i * (D + 1) + i] = s.get(i);
+    return a;
+}
+
+template <size_t D, typename T>
+constexpr Affine<D, T> Affine<D, T>::rotation(T cos_a, T sin_a) noexcept {
+    static_assert(D == 2, "rotation(cos, sin) is 2D only; use rotation(axis, angle)");
+    return Affine({cos_a, -sin_a, 0,
+                   sin_a, cos_a, 0});
+}
+
+template <size_t D, typename T>
+Affine<D, T> Affine<D, T>::rotation(T angle) {
+    static_assert(D == 2, "rotation(angle) is 2D only; use rotation(axis, angle)");
+    return rotation(std::cos(angle), std::sin(angle));
+}
+
+template <size_t D, typename T>
+Affine<D, T> Affine<D, T>::rotation(const Vector<3, T>& axis, T angle) {
+    static_assert(D == 3, "rotation(axis, angle) is 3D only");
+    Vector<3, T> u = axis.normalized();
+    const T x = u.get(0), y = u.get(1), z = u.get(2);
+    const T c = std::cos(angle), s = std::sin(angle), k = 1 - c;
+    return Affine({c + x * x * k,     x * y * k - z * s, x * z * k + y * s, 0,
+                   y * x * k + z * s, c + y * y * k,     y * z * k - x * s, 0,
+                   z * x * k - y * s, z * y * k + x * s, c + z * z * k,     0});
+}
+
+template <size_t D, typename T>
+constexpr Affine<D, T> Affine<D, T>::about(const Point<D, T>& pivot, const Affine& a) noexcept {
+    Vector<D, T> to_pivot = pivot - Point<D, T>();
+    return translation(to_pivot) * a * translation(to_pivot * T(-1));
+}
+
+template <size_t D, typename T>
+constexpr T Affine<D, T>::operator()(size_t row, size_t col) const noexcept {
+    assert(row <= D && col <= D);
+    if (row == D) return col == D ? T(1) : T(0);
+    return m[row * (D + 1) + col];
+}
+
+template <size_t D, typename T>
+constexpr Affine<D, T> Affine<D, T>::operator*(const Affine& other) const noexcept {
+    Affine res;
+    for (size_t r = 0; r < D; ++r)
+        for (size_t c = 0; c <= D; ++c) {
+            // the implicit last row of `other` only contributes to the translation column
+            T sum = c == D ? m[r * (D + 1) + D] : T(0);
+            for (size_t k = 0; k < D; ++k) sum += m[r * (D + 1) + k] * other.m[k * (D + 1) + c];
+            res.m[r * (D + 1) + c] = sum;
+        }
+    return res;
+}
+
+template <size_t D, typename T>
+constexpr T Affine<D, T>::determinant() const noexcept {
+    const auto& a = m;
+    if constexpr (D == 2) {
+        return a[0] * a[4] - a[1] * a[3];
+    } else {
+        return a[0] * (a[5] * a[10] - a[6] * a[9]) -
+               a[1] * (a[4] * a[10] - a[6] * a[8]) +
+               a[2] * (a[4] * a[9] - a[5] * a[8]);
+    }
+}
+
+template <size_t D, typename T>
+constexpr Affine<D, T> Affine<D, T>::inverse() const {
+    const T det = determinant();
+    if (det == 0) throw std::runtime_error("Cannot invert a singular transform");
+    const auto& a = m;
+    Affine inv;
+    auto& b = inv.m;
+    if constexpr (D == 2) {
+        b[0] = a[4] / det;  b[1] = -a[1] / det;
+        b[3] = -a[3] / det; b[4] = a[0] / det;
+    } else {
+        // adjugate over the determinant
+        b[0] = (a[5] * a[10] - a[6] * a[9]) / det;
+        b[1] = (a[2] * a[9] - a[1] * a[10]) / det;
+        b[2] = (a[1] * a[6] - a[2] * a[5]) / det;
+        b[4] = (a[6] * a[8] - a[4] * a[10]) / det;
+        b[5] = (a[0] * a[10] - a[2] * a[8]) / det;
+        b[6] = (a[2] * a[4] - a[0] * a[6]) / det;
+        b[8] = (a[4] * a[9] - a[5] * a[8]) / det;
+        b[9] = (a[1] * a[8] - a[0] * a[9]) / det;
+        b[10] = (a[0] * a[5] - a[1] * a[4]) / det;
+    }
+    // x = A^-1 (y - t)
+    for (size_t r = 0; r < D; ++r) {
+        T t = 0;
+        for (size_t k = 0; k < D; ++k) t -= b[r * (D + 1) + k] * a[k * (D + 1) + D];
+        b[r * (D + 1) + D] = t;
+    }
+    return inv;
+}
+
+template <size_t D, typename T>
+constexpr Point<D, T> Affine<D, T>::apply(const Point<D, T>& p) const noexcept {
+    Point<D, T> res;
+    for (size_t r = 0; r < D; ++r) {
+        T sum = m[r * (D + 1) + D];
+        for (size_t k = 0; k < D; ++k) sum += m[r * (D + 1) + k] * p.get(k);
+        res.get(r) = sum;
+    }
+    return res;
+}
+
+template <size_t D, typename T>
+constexpr Vector<D, T> Affine<D, T>::apply(const Vector<D, T>& v) const noexcept {
+    Vector<D, T> res;
+    for (size_t r = 0; r < D; ++r) {
+        T sum = 0;
+        for (size_t k = 0; k < D; ++k) sum += m[r * (D + 1) + k] * v.get(k);
+        res.get(r) = sum;
+    }
+    return res;
+}
+
+template <size_t D, typename T>
+Ray<D, T> Affine<D, T>::apply(const Ray<D, T>& r) const {
+    return Ray<D, T>(apply(r.origin), apply(r.direction));
+}
+
+// Point and Vector hold exactly D coordinates, so a buffer of them is one
+// interleaved coordinate array the kernels can run over directly.
+template <size_t D, typename T>
+void Affine<D, T>::apply(std::span<Point<D, T>> pts) const {
+    static_assert(sizeof(Point<D, T>) == D * sizeof(T), "Point must be packed");
+    if (pts.empty()) return;
+    if constexpr (D == 2) {
+        xy_affine2(&pts[0].get(0), pts.size(), m.data());
+    } else {
+        for (auto& p : pts) p = apply(p);
+    }
+}
+
+template <size_t D, typename T>
+void Affine<D, T>::apply(std::span<Vector<D, T>> vs) const {
+    static_assert(sizeof(Vector<D, T>) == D * sizeof(T), "Vector must be packed");
+    if (vs.empty()) return;
+    if constexpr (D == 2) {
+        const T linear[6] = {m[0], m[1], 0, m[3], m[4], 0};
+        xy_affine2(&vs[0].get(0), vs.size(), linear);
+    } else {
+        for (auto& v : vs) v = apply(v);
+    }
+}
+
+template <size_t D, typename T>
+void Affine<D, T>::apply(std::span<Ray<D, T>> rays) const {
+    for (auto& r : rays) {
+        r.origin = apply(r.origin);
+        r.direction = apply(r.direction);
+    }
+}
+
+template <size_t D, typename T>
+void Affine<D, T>::apply(PointSoA<D, T>& pts) const {
+    if constexpr (D == 2) soa_affine2(pts.data(0), pts.data(1), pts.size(), m.data());
+    else soa_affine3(pts.data(0), pts.data(1), pts.data(2), pts.size(), m.data());
+}
+
+template <size_t D, typename T>
+void Affine<D, T>::apply(VectorSoA<D, T>& vs) const {
+    std::array<T, D * (D + 1)> linear = m;
+    for (size_t r = 0; r < D; ++r) linear[r * (D + 1) + D] = 0;
+    if constexpr (D == 2) soa_affine2(vs.data(0), vs.data(1), vs.size(), linear.data());
+    else soa_affine3(vs.data(0), vs.data(1), vs.data(2), vs.size(), linear.data());
+}
+
+template <size_t D, typename T>
+std::pair<Point<D, T>, Point<D, T>> Affine<D, T>::apply_bounds(std::span<Point<D, T>> pts) const {
+    if (pts.empty()) throw std::invalid_argument("Cannot bound an empty point set");
+    Point<D, T> lo, hi;
+    if constexpr (D == 2) {
+        xy_affine2(&pts[0].get(0), pts.size(), m.data(), &lo.get(0), &hi.get(0));
+    } else {
+        for (size_t k = 0; k < D; ++k) {
+            lo.get(k) = std::numeric_limits<T>::max();
+            hi.get(k) = std::numeric_limits<T>::lowest();
+        }
+        for (auto& p : pts) {
+            p = apply(p);
+            for (size_t k = 0; k < D; ++k) {
+                lo.get(k) = std::min(lo.get(k), p.get(k));
+                hi.get(k) = std::max(hi.get(k), p.get(k));
+            }
+        }
+    }
+    return {lo, hi};
+}
+
+#endif // AFFINE_IPP
@@ -0,0 +1,212 @@
+#include "Affine.h"
+#include "../Ray/LineSegment.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+// Composition and application happen at compile time
+constexpr auto shift = Affine<2, double>::translation(Vector<2, double>{1, 2});
+constexpr auto quarter = Affine<2, double>::rotation(0.0, 1.0);
+static_assert(shift.then(quarter).apply(Point<2, double>{1, 0}) == Point<2, double>{-2, 2});
+static_assert((quarter * shift).inverse().apply(Point<2, double>{-2, 2}) == Point<2, double>{1, 0});
+static_assert(Affine<3, double>::scaling(Vector<3, double>{2, 3, 4}).determinant() == 24);
+static_assert(Affine<2, double>::about(Point<2, double>{1, 1}, Affine<2, double>::scaling(2))
+                  .apply(Point<2, double>{1, 1}) == Point<2, double>{1, 1});
+
+template <size_t D>
+static bool near(const Point<D, float>& a, const Point<D, float>& b, float tol = 1e-3f) {
+    for (size_t k = 0; k < D; ++k)
+        if (std::abs(a[k] - b[k]) > tol * (1 + std::abs(b[k]))) return false;
+    return true;
+}
+
+int main() {
+    using ms = std::chrono::duration<double, std::milli>;
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> pos(-100.0f, 100.0f), ang(-10.0f, 10.0f);
+
+    const size_t n = 1 << 20;
+    std::vector<Point<2, float>> pts(n);
+    for (auto& p : pts) p = Point<2, float>{pos(rng), pos(rng)};
+
+    const float angle = 0.7f;
+    const Vector<2, float> offset{3, -4};
+    const auto chain = Affine<2, float>::rotation(angle)
+                           .then(Affine<2, float>::scaling(Vector<2, float>{2, 0.5f}))
+                           .then(Affine<2, float>::translation(offset));
+
+    // Baseline: every stage applied to each point in turn
+    std::vector<Point<2, float>> naive = pts, batched = pts, fused = pts, split = pts;
+    auto t0 = std::chrono::steady_clock::now();
+    const float ca = std::cos(angle), sa = std::sin(angle);
+    for (auto& p : naive) {
+        Point<2, float> r{ca * p.dx() - sa * p.dy(), sa * p.dx() + ca * p.dy()};
+        r = Point<2, float>{2 * r.dx(), 0.5f * r.dy()};
+        p = r + offset;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    chain.apply(std::span<Point<2, float>>(batched));
+    auto t2 = std::chrono::steady_clock::now();
+
+    auto t3 = std::chrono::steady_clock::now();
+    auto box = chain.apply_bounds(std::span<Point<2, float>>(fused));
+    auto t4 = std::chrono::steady_clock::now();
+    chain.apply(std::span<Point<2, float>>(split));
+    Point<2, float> lo = split[0], hi = split[0];
+    for (const auto& p : split) {
+        lo = Point<2, float>{std::min(lo.dx(), p.dx()), std::min(lo.dy(), p.dy())};
+        hi = Point<2, float>{std::max(hi.dx(), p.dx()), std::max(hi.dy(), p.dy())};
+    }
+    auto t5 = std::chrono::steady_clock::now();
+
+    std::cout << "=== AFFINE PIPELINE, " << n << " points ===\n";
+    std::cout << "Stages applied per point: " << ms(t1 - t0).count() << " ms\n";
+    std::cout << "Composed matrix, batch kernel: " << ms(t2 - t1).count() << " ms\n";
+    std::cout << "Transform then bbox pass: " << ms(t5 - t4).count() << " ms, fused: "
+              << ms(t4 - t3).count() << " ms\n";
+
+    std::cout << "\n[TEST] Composed batch matches per-stage application: ";
+    size_t wrong = 0;
+    for (size_t i = 0; i < n; ++i) wrong += !near(batched[i], naive[i]);
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Fused bounds match a separate pass: ";
+    bool ok = box.first == lo && box.second == hi && fused == split;
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Inverse undoes the chain: ";
+    std::vector<Point<2, float>> back = batched;
+    chain.inverse().apply(std::span<Point<2, float>>(back));
+    wrong = 0;
+    for (size_t i = 0; i < n; ++i) wrong += !near(back[i], pts[i]);
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Singular map cannot be inverted: ";
+    try {
+        Affine<2, float>::scaling(Vector<2, float>{1, 0}).inverse();
+        std::cout << "FAIL\n";
+    } catch (const std::runtime_error&) {
+        std::cout << "PASS\n";
+    }
+
+    std::cout << "[TEST] Polygon transform scales area and refreshes the box: ";
+    Polygon<2, float> square({Point<2, float>{0, 0}, Point<2, float>{1, 0}, Point<2, float>{1, 1},
+                              Point<2, float>{0, 1}});
+    Polygon<2, float> moved = square;
+    chain.apply(moved);
+    auto pbox = moved.bounding_box();
+    Point<2, float> plo = chain.apply(square[0]), phi = plo;
+    ok = true;
+    for (size_t i = 0; i < square.size(); ++i) {
+        Point<2, float> q = chain.apply(square[i]);
+        ok = ok && near(moved[i], q);
+        plo = Point<2, float>{std::min(plo.dx(), q.dx()), std::min(plo.dy(), q.dy())};
+        phi = Point<2, float>{std::max(phi.dx(), q.dx()), std::max(phi.dy(), q.dy())};
+    }
+    ok = ok && std::abs(moved.area() - square.area() * std::abs(chain.determinant())) < 1e-4f &&
+         near(pbox.first, plo) && near(pbox.second, phi) &&
+         moved.isInside(chain.apply(Point<2, float>{0.5f, 0.5f})) && moved.is_convex();
+    moved.set_vertex(0, Point<2, float>{-50, -50});
+    ok = ok && moved.bounding_box().first == Point<2, float>{-50, -50};
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Ray hits keep their parameter under the map: ";
+    wrong = 0;
+    for (int i = 0; i < 1000; ++i) {
+        Ray<2, float> ray(Point<2, float>{pos(rng), pos(rng)}, Vector<2, float>{pos(rng), pos(rng)});
+        LineSegment<2, float> seg(Point<2, float>{pos(rng), pos(rng)}, Point<2, float>{pos(rng), pos(rng)});
+        auto t = ray.intersect(seg);
+        auto u = chain.apply(ray).intersect(LineSegment<2, float>(chain.apply(seg.a), chain.apply(seg.b)));
+        if (t && u) wrong += std::abs(*t - *u) > 1e-3f * (1 + std::abs(*t));
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] 3D rotation, SoA and AoS paths agree: ";
+    const auto spin = Affine<3, float>::rotation(Vector<3, float>{1, 2, 3}, 1.1f)
+                          .then(Affine<3, float>::translation(Vector<3, float>{1, 0, -1}));
+    std::vector<Point<3, float>> cloud(1000);
+    for (auto& p : cloud) p = Point<3, float>{pos(rng), pos(rng), pos(rng)};
+    PointSoA<3, float> soa(cloud);
+    spin.apply(soa);
+    std::vector<Point<3, float>> aos = cloud;
+    auto box3 = spin.apply_bounds(std::span<Point<3, float>>(aos));
+    wrong = 0;
+    for (size_t i = 0; i < cloud.size(); ++i) {
+        Point<3, float> q = spin.apply(cloud[i]);
+        wrong += !near(soa.get(i), q) || !near(aos[i], q);
+        for (size_t k = 0; k < 3; ++k) wrong += q[k] < box3.first[k] || q[k] > box3.second[k];
+        // rotations keep distances
+        Vector<3, float> before = cloud[i] - Point<3, float>(), after = q - spin.apply(Point<3, float>());
+        wrong += std::abs(before.magnitude() - after.magnitude()) > 1e-3f * before.magnitude();
+    }
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Vectors ignore the translation: ";
+    const std::vector<Vector<2, float>> orig{Vector<2, float>{1, 0}, Vector<2, float>{0, 1}, Vector<2, float>{3, 4}};
+    std::vector<Vector<2, float>> dirs = orig;
+    VectorSoA<2, float> dir_soa(orig);
+    chain.apply(std::span<Vector<2, float>>(dirs));
+    chain.apply(dir_soa);
+    ok = true;
+    for (size_t i = 0; i < dirs.size(); ++i) {
+        Vector<2, float> e = chain.apply(Point<2, float>() + orig[i]) - chain.apply(Point<2, float>());
+        ok = ok && (dirs[i] - e).magnitude() < 1e-4f && dirs[i] == dir_soa.get(i);
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    // Batch sincos against per-call trig
+    std::vector<float> a(n), w(n), h(n), d(n), c(n), s(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = ang(rng); w[i] = pos(rng); h[i] = pos(rng); d[i] = pos(rng);
+    }
+    auto t6 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i) {
+        c[i] = std::cos(a[i]);
+        s[i] = std::sin(a[i]);
+    }
+    auto t7 = std::chrono::steady_clock::now();
+    std::vector<float> bc(n), bs(n);
+    soa_sincos(a.data(), bc.data(), bs.data(), n);
+    auto t8 = std::chrono::steady_clock::now();
+
+    // best of a few warm runs, each on a fresh copy of the same start
+    std::vector<Vector<2, float>> start(n), vs;
+    for (auto& v : start) v = Vector<2, float>{pos(rng), pos(rng)};
+    VectorSoA<2, float> vsoa(start);
+    double per_call = 1e30, soa_move = 1e30;
+    for (int rep = 0; rep < 5; ++rep) {
+        vs = start;
+        vsoa = VectorSoA<2, float>(start);
+        auto t9 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; ++i) vs[i] = vs[i].moved(w[i], h[i], a[i], d[i]);
+        auto t10 = std::chrono::steady_clock::now();
+        vsoa.move(w, h, a, d);
+        auto t11 = std::chrono::steady_clock::now();
+        per_call = std::min(per_call, ms(t10 - t9).count());
+        soa_move = std::min(soa_move, ms(t11 - t10).count());
+    }
+
+    std::cout << "\nstd::cos + std::sin: " << ms(t7 - t6).count() << " ms, soa_sincos: "
+              << ms(t8 - t7).count() << " ms\n";
+    std::cout << "Vector::moved per call: " << per_call << " ms, VectorSoA::move: " << soa_move << " ms\n";
+
+    std::cout << "[TEST] Batch sincos matches std::cos and std::sin: ";
+    float err = 0;
+    for (size_t i = 0; i < n; ++i) err = std::max({err, std::abs(bc[i] - c[i]), std::abs(bs[i] - s[i])});
+    std::vector<double> big{0.0, -1e-300, 1e7, -3e8, 1e300};
+    std::vector<double> big_c(big.size()), big_s(big.size());
+    soa_sincos(big.data(), big_c.data(), big_s.data(), big.size());
+    for (size_t i = 0; i < big.size(); ++i)
+        err = std::max({err, float(std::abs(big_c[i] - std::cos(big[i]))), float(std::abs(big_s[i] - std::sin(big[i])))});
+    std::cout << (err < 1e-6f ? "PASS" : "FAIL") << " (max error " << err << ")\n";
+
+    std::cout << "[TEST] VectorSoA::move matches Vector::moved: ";
+    wrong = 0;
+    for (size_t i = 0; i < n; ++i) wrong += (vsoa.get(i) - vs[i]).magnitude() > 1e-3f;
+    std::cout << (wrong == 0 ? "PASS" : "FAIL") << "\n";
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+#ifndef TRIANGULATE_H
+#define TRIANGULATE_H
+
+#include "../Point/Point.h"
+#include "../Polygon/Polygon.h"
+#include "../Polygon/PolygonOps.h"
+#include "../Predicates/Predicates.h"
+#include <vector>
+#include <cstdint>
+
+// Triangulates a simple polygon in O(n log n): a top-to-bottom sweep adds
+// the diagonals that split it into y-monotone pieces (de Berg et al.,
+// chapter 3), and each piece is triangulated in linear time with a stack.
+//
+// Works on anything polygon-like (see PolygonOps.h): Polygon, PolygonView or
+// a std::array of Points, in either orientation. The result is an index
+// buffer into the polygon's vertices, three per triangle, each triangle
+// counter-clockwise; a polygon of n vertices gives n - 2 triangles. Input
+// that is not simple gives unspecified triangles. Throws
+// std::invalid_argument for fewer than 3 or more than 2^32 - 1 vertices.
+template <typename Poly>
+std::vector<uint32_t> triangulate(const Poly& poly);
+
+// Total area of the triangles in `tri` over the polygon's vertices
+template <typename Poly>
+double triangulated_area(const Poly& poly, const std::vector<uint32_t>& tri);
+
+#include "Triangulate.ipp"
+
+#endif // TRIANGULATE_H
@@ -0,0 +1,275 @@
+#ifndef TRIANGULATE_IPP
+#define TRIANGULATE_IPP
+
+#include "Triangulate.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+// Sweep state for the monotone decomposition of a counter-clockwise polygon.
+// Vertices are visited top to bottom, ties left to right; edge k runs from
+// vertex k to vertex k + 1. The status holds the edges crossing the sweep
+// line ordered west to east, compared with orient2d only.
+template <typename T>
+class MonotoneSweep {
+    enum Kind : uint8_t { Start, End, Split, Merge, Regular };
+
+    // Status entries carry their edge's endpoints, upper first, so a
+    // comparison reads only the tree nodes it visits
+    struct Active { Point<2, T> up, lo; uint32_t e; };
+
+    const std::vector<Point<2, T>>& P;
+    const uint32_t n;
+
+    uint32_t next(uint32_t k) const { return k + 1 < n ? k + 1 : 0; }
+    uint32_t prev(uint32_t k) const { return k ? k - 1 : n - 1; }
+    static bool above(const Point<2, T>& a, const Point<2, T>& b) {
+        return a.dy() > b.dy() || (a.dy() == b.dy() && a.dx() < b.dx());
+    }
+    bool above(uint32_t a, uint32_t b) const { return above(P[a], P[b]); }
+    Active active(uint32_t e) const {
+        uint32_t q = next(e);
+        return above(e, q) ? Active{P[e], P[q], e} : Active{P[q], P[e], e};
+    }
+    // > 0 if p lies east of edge a
+    static double side(const Active& a, const Point<2, T>& p) { return orient2d(a.up, a.lo, p); }
+
+    struct WestOf {
+        using is_transparent = void;
+        bool operator()(const Active& a, const Active& b) const {
+            if (a.e == b.e) return false;
+            if (above(b.up, a.up)) {
+                double o = side(b, a.up);
+                return o != 0 ? o < 0 : side(b, a.lo) < 0;
+            }
+            double o = side(a, b.up);
+            return o != 0 ? o > 0 : side(a, b.lo) > 0;
+        }
+        bool operator()(const Active& a, const Point<2, T>& p) const { return side(a, p) > 0; }
+        bool operator()(const Point<2, T>& p, const Active& a) const { return side(a, p) < 0; }
+    };
+
+public:
+    MonotoneSweep(const std::vector<Point<2, T>>& pts) : P(pts), n(static_cast<uint32_t>(pts.size())) {}
+
+    // Diagonals that cut the polygon into y-monotone pieces
+    std::vector<std::pair<uint32_t, uint32_t>> diagonals() const {
+        // Sorted with the coordinates inline; an index sort would chase P
+        std::vector<std::pair<Point<2, T>, uint32_t>> order(n);
+        for (uint32_t k = 0; k < n; ++k) order[k] = {P[k], k};
+        std::sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return above(a.first, b.first); });
+
+        std::vector<Kind> kind(n);
+        for (uint32_t k = 0; k < n; ++k) {
+            uint32_t p = prev(k), q = next(k);
+            bool convex = orient2d(P[p], P[k], P[q]) >= 0;
+            if (above(k, p) && above(k, q)) kind[k] = convex ? Start : Split;
+            else if (above(p, k) && above(q, k)) kind[k] = convex ? End : Merge;
+            else kind[k] = Regular;
+        }
+
+        using Status = std::set<Active, WestOf>;
+        Status status;
+        std::vector<typename Status::iterator> where(n);
+        std::vector<uint32_t> helper(n);
+        std::vector<std::pair<uint32_t, uint32_t>> diag;
+        auto left_of = [&](uint32_t v) {
+            auto it = status.lower_bound(P[v]);
+            if (it == status.begin()) throw std::invalid_argument("Polygon is not simple");
+            return (--it)->e;
+        };
+        // Every new edge but a start vertex's lands right after a known
+        // one, so the hinted inserts skip the tree descent
+        auto insert = [&](uint32_t e, typename Status::iterator hint) {
+            where[e] = status.insert(hint, active(e));
+            helper[e] = e;
+        };
+        auto close = [&](uint32_t v, uint32_t e) {   // edge e ends at v
+            if (kind[helper[e]] == Merge) diag.emplace_back(v, helper[e]);
+            return status.erase(where[e]);
+        };
+        auto pass_left = [&](uint32_t v) {           // v becomes the helper on its left
+            uint32_t e = left_of(v);
+            if (kind[helper[e]] == Merge || kind[v] == Split) diag.emplace_back(v, helper[e]);
+            helper[e] = v;
+            return e;
+        };
+
+        for (const auto& entry : order) {
+            const uint32_t v = entry.second;
+            switch (kind[v]) {
+            case Start: insert(v, status.lower_bound(active(v))); break;
+            case End: close(v, prev(v)); break;
+            case Split: insert(v, std::next(where[pass_left(v)])); break;
+            case Merge: close(v, prev(v)); pass_left(v); break;
+            case Regular:
+                if (above(prev(v), v)) insert(v, close(v, prev(v)));   // interior to the east
+                else pass_left(v);
+                break;
+            }
+        }
+        return diag;
+    }
+};
+
+// Stack triangulation of one y-monotone piece given counter-clockwise
+template <typename T>
+void triangulate_monotone(const std::vector<Point<2, T>>& P, const std::vector<uint32_t>& piece,
+                          std::vector<uint32_t>& out) {
+    const size_t m = piece.size();
+    auto above = [&](uint32_t a, uint32_t b) {
+        return P[a].dy() > P[b].dy() || (P[a].dy() == P[b].dy() && P[a].dx() < P[b].dx());
+    };
+    auto emit = [&](uint32_t a, uint32_t b, uint32_t c) {
+        if (orient2d(P[a], P[b], P[c]) < 0) std::swap(b, c);
+        out.push_back(a); out.push_back(b); out.push_back(c);
+    };
+    if (m == 3) {
+        emit(piece[0], piece[1], piece[2]);
+        return;
+    }
+
+    // Counter-clockwise from the top runs down the left chain
+    size_t top = 0, bottom = 0;
+    for (size_t k = 1; k < m; ++k) {
+        if (above(piece[k], piece[top])) top = k;
+        if (above(piece[bottom], piece[k])) bottom = k;
+    }
+    std::vector<std::pair<uint32_t, bool>> u;   // vertex, on the left chain
+    u.reserve(m);
+    size_t l = top, r = (top + m - 1) % m;
+    u.emplace_back(piece[top], true);
+    while (u.size() < m) {
+        bool take_left = l != bottom && (r == bottom || above(piece[(l + 1) % m], piece[r]));
+        if (take_left) {
+            l = (l + 1) % m;
+            u.emplace_back(piece[l], l != bottom);
+        } else {
+            u.emplace_back(piece[r], false);
+            r = (r + m - 1) % m;
+        }
+    }
+
+    std::vector<std::pair<uint32_t, bool>> stack{u[0], u[1]};
+    for (size_t j = 2; j + 1 < m; ++j) {
+        auto [v, left] = u[j];
+        if (left != stack.back().second) {
+            for (size_t k = stack.size() - 1; k > 0; --k) emit(v, stack[k].first, stack[k - 1].first);
+            stack.assign({u[j - 1], u[j]});
+        } else {
+            auto last = stack.back();
+            stack.pop_back();
+            while (!stack.empty()) {
+                uint32_t s = stack.back().first;
+                double o = left ? orient2d(P[s], P[last.first], P[v]) : orient2d(P[v], P[last.first], P[s]);
+                if (o <= 0) break;
+                emit(v, last.first, s);
+                last = stack.back();
+                stack.pop_back();
+            }
+            stack.push_back(last);
+            stack.push_back(u[j]);
+        }
+    }
+    const uint32_t v = u[m - 1].first;
+    for (size_t k = stack.size() - 1; k > 0; --k) emit(v, stack[k].first, stack[k - 1].first);
+}
+
+template <typename Poly>
+std::vector<uint32_t> triangulate(const Poly& poly) {
+    using T = polygon_coord_t<Poly>;
+    const size_t n = poly.size();
+    if (n < 3) throw std::invalid_argument("Polygon must have at least 3 vertices");
+    if (n > std::numeric_limits<uint32_t>::max())
+        throw std::invalid_argument("triangulate supports at most 2^32 - 1 vertices");
+
+    // Work on a counter-clockwise copy; `original` maps back
+    double area2 = 0;
+    for (size_t i = 0; i < n; ++i) {
+        Point<2, T> a = polygon_vertex(poly, i), b = polygon_vertex(poly, i + 1 < n ? i + 1 : 0);
+        area2 += double(a.dx()) * b.dy() - double(b.dx()) * a.dy();
+    }
+    const bool ccw = area2 >= 0;
+    auto original = [&](uint32_t k) { return ccw ? k : static_cast<uint32_t>(n - 1 - k); };
+    std::vector<Point<2, T>> P(n);
+    for (uint32_t k = 0; k < n; ++k) P[k] = polygon_vertex(poly, original(k));
+
+    std::vector<uint32_t> tri;
+    tri.reserve(3 * (n - 2));
+    const auto diag = MonotoneSweep<T>(P).diagonals();
+    if (diag.empty()) {
+        std::vector<uint32_t> all(n);
+        for (uint32_t k = 0; k < n; ++k) all[k] = k;
+        triangulate_monotone(P, all, tri);
+    } else {
+        // Half-edges of the polygon plus diagonals, sorted counter-clockwise
+        // around each vertex; a face continues with the half-edge just
+        // clockwise of the one it arrived along
+        std::vector<uint32_t> start(n + 1, 2);
+        start[n] = 0;
+        for (const auto& [a, b] : diag) { ++start[a]; ++start[b]; }
+        for (size_t k = 0, sum = 0; k <= n; ++k) {
+            size_t c = k < n ? start[k] : 0;
+            start[k] = static_cast<uint32_t>(sum);
+            sum += c;
+        }
+        std::vector<uint32_t> to(start[n]), fill(start.begin(), start.end() - 1);
+        for (uint32_t k = 0; k < n; ++k) {
+            to[fill[k]++] = k + 1 < n ? k + 1 : 0;
+            to[fill[k]++] = k ? k - 1 : static_cast<uint32_t>(n - 1);
+        }
+        for (const auto& [a, b] : diag) {
+            to[fill[a]++] = b;
+            to[fill[b]++] = a;
+        }
+        for (uint32_t w = 0; w < n; ++w) {
+            if (start[w + 1] - start[w] == 2) continue;
+            auto upper = [&](uint32_t t) {
+                return P[t].dy() > P[w].dy() || (P[t].dy() == P[w].dy() && P[t].dx() > P[w].dx());
+            };
+            std::sort(to.begin() + start[w], to.begin() + start[w + 1], [&](uint32_t a, uint32_t b) {
+                bool ua = upper(a), ub = upper(b);
+                if (ua != ub) return ua;
+                return orient2d(P[w], P[a], P[b]) > 0;
+            });
+        }
+        auto find = [&](uint32_t w, uint32_t t) {
+            return static_cast<uint32_t>(std::find(to.begin() + start[w], to.begin() + start[w + 1], t) - to.begin());
+        };
+
+        std::vector<uint8_t> used(to.size(), 0);
+        for (uint32_t k = 0; k < n; ++k) used[find(k, k ? k - 1 : static_cast<uint32_t>(n - 1))] = 1;   // outside
+        std::vector<uint32_t> piece;
+        for (uint32_t w0 = 0; w0 < n; ++w0)
+            for (uint32_t h0 = start[w0]; h0 < start[w0 + 1]; ++h0) {
+                if (used[h0]) continue;
+                piece.clear();
+                uint32_t w = w0, h = h0;
+                while (!used[h]) {
+                    used[h] = 1;
+                    piece.push_back(w);
+                    uint32_t t = to[h];
+                    uint32_t back = find(t, w);
+                    h = back > start[t] ? back - 1 : start[t + 1] - 1;
+                    w = t;
+                }
+                triangulate_monotone(P, piece, tri);
+            }
+    }
+    for (auto& k : tri) k = original(k);
+    return tri;
+}
+
+template <typename Poly>
+double triangulated_area(const Poly& poly, const std::vector<uint32_t>& tri) {
+    double sum = 0;
+    for (size_t t = 0; t + 2 < tri.size(); t += 3)
+        sum += orient2d(polygon_vertex(poly, tri[t]), polygon_vertex(poly, tri[t + 1]),
+                        polygon_vertex(poly, tri[t + 2])) / 2;
+    return sum;
+}
+
+#endif // TRIANGULATE_IPP
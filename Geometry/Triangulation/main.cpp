@@ -0,0 +1,153 @@
+#include "Triangulate.h"
+#include "../Polygon/PolygonView.h"
+#include "../Hull/ConvexHull.h"
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <string>
+
+using ms = std::chrono::duration<double, std::milli>;
+
+// Star-shaped with random radii: about a third of the vertices are reflex,
+// so the sweep meets many split and merge vertices
+static std::vector<Point<2, float>> star(std::mt19937& rng, size_t n) {
+    std::uniform_real_distribution<float> radius(100.0f, 1000.0f);
+    std::vector<Point<2, float>> pts(n);
+    for (size_t k = 0; k < n; ++k) {
+        double a = 2 * M_PI * k / n;
+        float r = radius(rng);
+        pts[k] = Point<2, float>{float(r * std::cos(a)), float(r * std::sin(a))};
+    }
+    return pts;
+}
+
+// Smooth wavy outline, closer to real data: the sweep line crosses few edges
+static std::vector<Point<2, float>> flower(size_t n) {
+    std::vector<Point<2, float>> pts(n);
+    for (size_t k = 0; k < n; ++k) {
+        double a = 2 * M_PI * k / n, r = 1000 + 300 * std::sin(40 * a);
+        pts[k] = Point<2, float>{float(r * std::cos(a)), float(r * std::sin(a))};
+    }
+    return pts;
+}
+
+// Band with teeth on both sides: split vertices along the bottom, merge
+// vertices along the top, and horizontal edges nowhere
+static std::vector<Point<2, float>> comb(size_t teeth) {
+    std::vector<Point<2, float>> pts;
+    for (size_t k = 0; k <= 2 * teeth; ++k) pts.push_back(Point<2, float>{float(k), float(k % 2)});
+    for (size_t k = 2 * teeth + 1; k-- > 0;) pts.push_back(Point<2, float>{float(k), float(3 - int(k % 2))});
+    return pts;
+}
+
+// Axis-aligned staircase with collinear vertices along every edge
+static std::vector<Point<2, float>> staircase(size_t steps) {
+    std::vector<Point<2, float>> pts;
+    for (size_t k = 0; k <= 2 * steps; ++k) pts.push_back(Point<2, float>{float(k), 0});
+    for (size_t k = steps; k > 0; --k) {
+        pts.push_back(Point<2, float>{float(2 * k), float(steps - k + 1)});
+        pts.push_back(Point<2, float>{float(2 * k - 1), float(steps - k + 1)});
+    }
+    pts.push_back(Point<2, float>{0, float(steps)});
+    pts.push_back(Point<2, float>{0, float(steps) / 2});
+    return pts;
+}
+
+// n - 2 counter-clockwise triangles covering the polygon's area; with
+// `edges`, also every boundary edge used once and every diagonal twice
+template <typename Poly>
+static bool valid(const Poly& poly, const std::vector<uint32_t>& tri, bool edges, bool strict = true) {
+    const size_t n = poly.size();
+    if (tri.size() != 3 * (n - 2)) return false;
+    for (size_t t = 0; t < tri.size(); t += 3) {
+        double o = orient2d(poly[tri[t]], poly[tri[t + 1]], poly[tri[t + 2]]);
+        if (strict ? o <= 0 : o < 0) return false;
+    }
+    double area = 0;
+    for (size_t i = 0; i < n; ++i) {
+        auto a = poly[i], b = poly[i + 1 < n ? i + 1 : 0];
+        area += (double(a.dx()) * b.dy() - double(b.dx()) * a.dy()) / 2;
+    }
+    const bool ccw = area > 0;
+    area = std::abs(area);
+    if (std::abs(triangulated_area(poly, tri) - area) > 1e-6 * area) return false;
+    if (!edges) return true;
+
+    std::map<std::pair<uint32_t, uint32_t>, int> count;
+    for (size_t t = 0; t < tri.size(); t += 3)
+        for (size_t k = 0; k < 3; ++k) ++count[{tri[t + k], tri[t + (k + 1) % 3]}];
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t j = i + 1 < n ? i + 1 : 0;
+        auto boundary = ccw ? std::make_pair(i, j) : std::make_pair(j, i);
+        if (count[boundary] != 1) return false;
+        count.erase(boundary);
+    }
+    for (const auto& [e, c] : count)
+        if (c != 1 || count.count({e.second, e.first}) != 1) return false;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::mt19937 rng(13);
+    const size_t max_n = argc > 1 ? std::stoul(argv[1]) : 10000000;
+
+    std::cout << "=== TRIANGULATION ===\n";
+    bool ok = true;
+    for (size_t n = 10000; n <= max_n; n *= 10)
+        for (int shape = 0; shape < 2; ++shape) {
+            auto pts = shape == 0 ? flower(n) : star(rng, n);
+            PolygonView<2, float> view(&pts[0][0], pts.size());
+            auto t0 = std::chrono::steady_clock::now();
+            auto tri = triangulate(view);
+            auto t1 = std::chrono::steady_clock::now();
+            ok = ok && valid(view, tri, false);
+            std::cout << (shape == 0 ? "flower" : "star") << " n=" << n << ": " << tri.size() / 3 << " triangles, "
+                      << ms(t1 - t0).count() << " ms, " << (tri.size() * sizeof(uint32_t)) / (1 << 20)
+                      << " MiB of indices\n";
+        }
+    std::cout << "\n[TEST] Large polygons give n - 2 triangles covering the area: " << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Squares, combs, stars and staircases tile exactly: ";
+    Polygon<2, float> square{Point<2, float>{0, 0}, Point<2, float>{1, 0}, Point<2, float>{1, 1},
+                             Point<2, float>{0, 1}};
+    ok = valid(square, triangulate(square), true);
+    for (size_t k : {1, 2, 7, 500}) {
+        Polygon<2, float> c(comb(k)), s(staircase(k));
+        ok = ok && valid(c, triangulate(c), true) && valid(s, triangulate(s), true, false);
+    }
+    for (size_t n : {3, 4, 5, 20, 1000, 20000}) {
+        Polygon<2, float> s(star(rng, n));
+        ok = ok && valid(s, triangulate(s), true);
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Clockwise input gives counter-clockwise triangles: ";
+    auto pts = star(rng, 1000);
+    std::vector<Point<2, float>> reversed(pts.rbegin(), pts.rend());
+    Polygon<2, float> cw(reversed);
+    ok = cw.signed_area() < 0 && valid(cw, triangulate(cw), true);
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Indices match between Polygon and PolygonView: ";
+    Polygon<2, float> poly(pts);
+    PolygonView<2, float> view(&pts[0][0], pts.size());
+    std::cout << (triangulate(poly) == triangulate(view) ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Convex hull polygon triangulates exactly: ";
+    std::uniform_real_distribution<float> u(-100.0f, 100.0f);
+    std::vector<Point<2, float>> cloud(100000);
+    for (auto& p : cloud) p = Point<2, float>{u(rng), u(rng)};
+    Polygon<2, float> hull = ConvexHull<2, float>(cloud).polygon(cloud);
+    std::cout << (valid(hull, triangulate(hull), true) ? "PASS" : "FAIL") << "\n";
+
+    std::cout << "[TEST] Fewer than 3 vertices throws: ";
+    try {
+        triangulate(PolygonView<2, float>(&pts[0][0], 2));
+        std::cout << "FAIL\n";
+    } catch (const std::invalid_argument&) {
+        std::cout << "PASS\n";
+    }
+    return 0;
+}
@@ -3,7 +3,8 @@
 #include <cmath>
 
 template <size_t D, typename Coord_t>
-Vector<D, Coord_t>::Vector(std::initializer_list<Coord_t> lst)
+constexpr Vector<D, Coord_t>::Vector(std::initializer_list<Coord_t> lst)
+    : components{}
 {
     if (lst.size() != D)
         throw std::invalid_argument("Initializer list size must match dimension");
@@ -12,19 +13,19 @@ Vector<D, Coord_t>::Vector(std::initializer_list<Coord_t> lst)
 }
 
 template <size_t D, typename Coord_t>
-bool Vector<D, Coord_t>::operator==(const Vector& other) const
+constexpr bool Vector<D, Coord_t>::operator==(const Vector& other) const noexcept
 {
     return components == other.components;
 }
 
 template <size_t D, typename Coord_t>
-bool Vector<D, Coord_t>::operator!=(const Vector& other) const
+constexpr bool Vector<D, Coord_t>::operator!=(const Vector& other) const noexcept
 {
     return !(*this == other);
 }
 
 template <size_t D, typename Coord_t>
-Vector<D, Coord_t> Vector<D, Coord_t>::operator+(const Vector& other) const
+constexpr Vector<D, Coord_t> Vector<D, Coord_t>::operator+(const Vector& other) const noexcept
 {
     Vector res;
     for (std::size_t i = 0; i < D; ++i)
@@ -33,7 +34,7 @@ Vector<D, Coord_t> Vector<D, Coord_t>::operator+(const Vector& other) const
 }
 
 template <size_t D, typename Coord_t>
-Vector<D, Coord_t> Vector<D, Coord_t>::operator-(const Vector& other) const
+constexpr Vector<D, Coord_t> Vector<D, Coord_t>::operator-(const Vector& other) const noexcept
 {
     Vector res;
     for (std::size_t i = 0; i < D; ++i)
@@ -42,21 +43,21 @@ Vector<D, Coord_t> Vector<D, Coord_t>::operator-(const Vector& other) const
 }
 
 template <size_t D, typename Coord_t>
-Vector<D, Coord_t>& Vector<D, Coord_t>::operator+=(const Vector& other)
+constexpr Vector<D, Coord_t>& Vector<D, Coord_t>::operator+=(const Vector& other) noexcept
 {
     for (std::size_t i = 0; i < D; ++i) components[i] += other.components[i];
     return *this;
 }
 
 template <size_t D, typename Coord_t>
-Vector<D, Coord_t>& Vector<D, Coord_t>::operator-=(const Vector& other)
+constexpr Vector<D, Coord_t>& Vector<D, Coord_t>::operator-=(const Vector& other) noexcept
 {
     for (std::size_t i = 0; i < D; ++i) components[i] -= other.components[i];
     return *this;
 }
 
 template <size_t D, typename Coord_t>
-Vector<D, Coord_t> Vector<D, Coord_t>::operator*(Coord_t s) const
+constexpr Vector<D, Coord_t> Vector<D, Coord_t>::operator*(Coord_t s) const noexcept
 {
     Vector res;
     for (std::size_t i = 0; i < D; ++i) res.components[i] = components[i] * s;
@@ -64,49 +65,49 @@ Vector<D, Coord_t> Vector<D, Coord_t>::operator*(Coord_t s) const
 }
 
 template <size_t D, typename Coord_t>
-Vector<D, Coord_t>& Vector<D, Coord_t>::operator*=(Coord_t s)
+constexpr Vector<D, Coord_t>& Vector<D, Coord_t>::operator*=(Coord_t s) noexcept
 {
     for (std::size_t i = 0; i < D; ++i) components[i] *= s;
     return *this;
 }
 
 template <size_t D, typename Coord_t>
-Coord_t& Vector<D, Coord_t>::operator[](std::size_t i)
+constexpr Coord_t& Vector<D, Coord_t>::operator[](std::size_t i)
 {
     if (i >= D) throw std::out_of_range("Vector index out of range");
     return components[i];
 }
 
 template <size_t D, typename Coord_t>
-const Coord_t& Vector<D, Coord_t>::operator[](std::size_t i) const
+constexpr const Coord_t& Vector<D, Coord_t>::operator[](std::size_t i) const
 {
     if (i >= D) throw std::out_of_range("Vector index out of range");
     return components[i];
 }
 
 template <size_t D, typename Coord_t>
-Coord_t Vector<D, Coord_t>::dot_product(const Vector& a, const Vector& b)
+constexpr Coord_t Vector<D, Coord_t>::dot_product(const Vector& a, const Vector& b) noexcept
 {
     Coord_t sum = 0;
-    for (std::size_t i = 0; i < D; ++i) sum += a[i] * b[i];
+    for (std::size_t i = 0; i < D; ++i) sum += a.components[i] * b.components[i];
     return sum;
 }
 
 template <size_t D, typename Coord_t>
-Coord_t Vector<D, Coord_t>::cross_2d(const Vector& other) const
+constexpr Coord_t Vector<D, Coord_t>::cross_2d(const Vector& other) const noexcept
 {
     static_assert(D == 2, "cross_2d is only defined for 2-D vectors");
-    return components[0] * other[1] - components[1] * other[0];
+    return components[0] * other.components[1] - components[1] * other.components[0];
 }
 
 template <size_t D, typename Coord_t>
-Vector<D, Coord_t> Vector<D, Coord_t>::cross_product(const Vector& a, const Vector& b)
+constexpr Vector<D, Coord_t> Vector<D, Coord_t>::cross_product(const Vector& a, const Vector& b) noexcept
 {
     static_assert(D == 3, "cross_product is only defined for 3-D vectors");
+    const auto& u = a.components;
+    const auto& v = b.components;
     Vector<3, Coord_t> res;
-    res[0] = a[1] * b[2] - a[2] * b[1];
-    res[1] = a[2] * b[0] - a[0] * b[2];
-    res[2] = a[0] * b[1] - a[1] * b[0];
+    res.components = {u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
     return res;
 }
 
@@ -127,28 +128,28 @@ Vector<D, Coord_t> Vector<D, Coord_t>::normalized() const
 }
 
 template <size_t D, typename Coord_t>
-Coord_t Vector<D, Coord_t>::dx() const
+constexpr Coord_t Vector<D, Coord_t>::dx() const noexcept
 {
     static_assert(D >= 1, "dx() requires at least 1 dimension");
     return components[0];
 }
 
 template <size_t D, typename Coord_t>
-Coord_t Vector<D, Coord_t>::dy() const
+constexpr Coord_t Vector<D, Coord_t>::dy() const noexcept
 {
     static_assert(D >= 2, "dy() requires at least 2 dimensions");
     return components[1];
 }
 
 template <size_t D, typename Coord_t>
-void Vector<D, Coord_t>::set_dx(Coord_t x)
+constexpr void Vector<D, Coord_t>::set_dx(Coord_t x) noexcept
 {
     static_assert(D >= 1, "set_dx() requires at least 1 dimension");
     components[0] = x;
 }
 
 template <size_t D, typename Coord_t>
-void Vector<D, Coord_t>::set_dy(Coord_t y)
+constexpr void Vector<D, Coord_t>::set_dy(Coord_t y) noexcept
 {
     static_assert(D >= 2, "set_dy() requires at least 2 dimensions");
     components[1] = y;
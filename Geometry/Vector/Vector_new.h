@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include <cmath>
 #include <type_traits>
+#include <cassert>
 
 template <size_t D, typename Coord_t>
 class Vector
@@ -17,39 +18,44 @@ class Vector
     std::array<Coord_t, D> components;
 
 public:
-    Vector() { components.fill(0); }
-    explicit Vector(std::initializer_list<Coord_t> lst);
+    constexpr Vector() noexcept : components{} {}
+    constexpr explicit Vector(std::initializer_list<Coord_t> lst);
 
-    Vector(const Vector&) = default;
-    Vector(Vector&&) noexcept = default;
-    Vector& operator=(const Vector&) = default;
-    Vector& operator=(Vector&&) noexcept = default;
+    constexpr Vector(const Vector&) = default;
+    constexpr Vector(Vector&&) noexcept = default;
+    constexpr Vector& operator=(const Vector&) = default;
+    constexpr Vector& operator=(Vector&&) noexcept = default;
 
-    bool operator==(const Vector& other) const;
-    bool operator!=(const Vector& other) const;
+    constexpr bool operator==(const Vector& other) const noexcept;
+    constexpr bool operator!=(const Vector& other) const noexcept;
 
-    Vector operator+(const Vector& other) const;
-    Vector operator-(const Vector& other) const;
-    Vector& operator+=(const Vector& other);
-    Vector& operator-=(const Vector& other);
-    Vector operator*(Coord_t scalar) const;
-    Vector& operator*=(Coord_t scalar);
-    friend Vector operator*(Coord_t scalar, const Vector& v) { return v * scalar; }
+    constexpr Vector operator+(const Vector& other) const noexcept;
+    constexpr Vector operator-(const Vector& other) const noexcept;
+    constexpr Vector& operator+=(const Vector& other) noexcept;
+    constexpr Vector& operator-=(const Vector& other) noexcept;
+    constexpr Vector operator*(Coord_t scalar) const noexcept;
+    constexpr Vector& operator*=(Coord_t scalar) noexcept;
+    friend constexpr Vector operator*(Coord_t scalar, const Vector& v) noexcept { return v * scalar; }
 
-    Coord_t& operator[](size_t i);
-    const Coord_t& operator[](size_t i) const;
+    // Checked access, throws std::out_of_range
+    constexpr Coord_t& operator[](size_t i);
+    constexpr const Coord_t& operator[](size_t i) const;
 
-    static Coord_t dot_product(const Vector& a, const Vector& b);
-    Coord_t cross_2d(const Vector& other) const;
-    static Vector cross_product(const Vector& a, const Vector& b);
+    // Unchecked access for inner loops; asserts in debug builds only
+    constexpr Coord_t& get(size_t i) noexcept { assert(i < D); return components[i]; }
+    constexpr const Coord_t& get(size_t i) const noexcept { assert(i < D); return components[i]; }
+
+    static constexpr Coord_t dot_product(const Vector& a, const Vector& b) noexcept;
+    constexpr Coord_t cross_2d(const Vector& other) const noexcept;
+    static constexpr Vector cross_product(const Vector& a, const Vector& b) noexcept;
 
     Coord_t magnitude() const;
     Vector normalized() const;
 
-    Coord_t dx() const;
-    Coord_t dy() const;
-    void set_dx(Coord_t x);
-    void set_dy(Coord_t y);
+    constexpr Coord_t dx() const noexcept;
+    constexpr Coord_t dy() const noexcept;
+    constexpr void set_dx(Coord_t x) noexcept;
+    constexpr void set_dy(Coord_t y) noexcept;
     Vector moved(Coord_t w, Coord_t h, Coord_t a, Coord_t d) const;
 
     // operator<< defined inline
@@ -66,7 +72,7 @@ public:
     return os;
     }
 
-    Coord_t squared_magnitude() const {
+    constexpr Coord_t squared_magnitude() const noexcept {
         Coord_t sum = 0;
         for (size_t i = 0; i < D; ++i)
             sum += components[i] * components[i];